@@ -56,8 +56,7 @@ void tP_calc(tP* ptP)
 {
 	float fPreOut = ptP->fIn * ptP->fKp;
 	
-	if(fPreOut > ptP->fUpOutLim) fPreOut = ptP->fUpOutLim;
-	if(fPreOut < ptP->fLowOutLim) fPreOut = ptP->fLowOutLim;
+	fPreOut = PID_SATF(fPreOut, ptP->fLowOutLim, ptP->fUpOutLim);
 	
 	ptP->fOut = fPreOut;
 }
@@ -73,6 +72,21 @@ void tP_rst(tP* ptP)
 	ptP->fOut = 0.0f;
 }
 
+/**
+  * @brief  Initialize the PI-controller coefficients (m_calc calls it after the
+  *	    change of fDtSec, must be called after the change of the anti-windup
+  *	    settings uAwMode or fKaw).
+  * @param  ptPI: pointer to user data structure with type "ptPI".               
+  * @retval None
+  */
+void tPI_init(tPI* ptPI)
+{
+	ptPI->fDtInit = ptPI->fDtSec;
+	ptPI->fHalfDt = 0.5f*ptPI->fDtSec;
+	ptPI->fAwKdt = (ptPI->uAwMode == PID_AW_BACKCALC) ? ptPI->fKaw*ptPI->fDtSec : 0.0f;
+	ptPI->fAwClamp = (ptPI->uAwMode == PID_AW_CLAMP) ? 1.0f : 0.0f;
+}
+
 /**
   * @brief  Calculate and update the PI-controller output.
   * @param  ptPI: pointer to user data structure with type "ptPI".               
@@ -80,21 +94,25 @@ void tP_rst(tP* ptP)
   */
 void tPI_calc(tPI* ptPI)
 {
-	float fPreOut;
+	float fPreOut, fOut, fIout;
+	
+	if(ptPI->fDtSec != ptPI->fDtInit) tPI_init(ptPI);	// new discretization time
 	
 	ptPI->fPout = ptPI->fIn * ptPI->fKp;
 	
-	ptPI->fIout = ptPI->fIprevOut + 0.5f*ptPI->fDtSec*(
+	fIout = ptPI->fIprevOut + ptPI->fHalfDt*(
 			ptPI->fPout*ptPI->fKi + ptPI->fIprevIn);
 	ptPI->fIprevIn = ptPI->fPout;
-	ptPI->fIprevOut = ptPI->fIout;
 	
-	fPreOut = ptPI->fPout + ptPI->fIout;
+	fPreOut = ptPI->fPout + fIout;
 	
-	if(fPreOut > ptPI->fUpOutLim) fPreOut = ptPI->fUpOutLim;
-	if(fPreOut < ptPI->fLowOutLim) fPreOut = ptPI->fLowOutLim;
+	fOut = PID_SATF(fPreOut, ptPI->fLowOutLim, ptPI->fUpOutLim);
 	
-	ptPI->fOut = fPreOut;
+	ptPI->fIout = tPID_aw(fIout, ptPI->fIprevOut, fOut - fPreOut,
+			      ptPI->fAwKdt, ptPI->fAwClamp);
+	ptPI->fIprevOut = ptPI->fIout;
+	
+	ptPI->fOut = fOut;
 }
 
 /**
@@ -112,6 +130,18 @@ void tPI_rst(tPI* ptPI)
 	ptPI->fPout = 0.0f;
 }
 
+/**
+  * @brief  Initialize the PD-controller coefficients (m_calc calls it after the
+  *	    change of fDtSec).
+  * @param  ptPD: pointer to user data structure with type "ptPD".               
+  * @retval None
+  */
+void tPD_init(tPD* ptPD)
+{
+	ptPD->fDtInit = ptPD->fDtSec;
+	ptPD->f1divDt = 1.0f/ptPD->fDtSec;
+}
+
 /**
   * @brief  Calculate and update the PD-controller output.
   * @param  ptPD: pointer to user data structure with type "ptPD".               
@@ -121,16 +151,17 @@ void tPD_calc(tPD* ptPD)
 {
 	float fPreOut;
 	
+	if(ptPD->fDtSec != ptPD->fDtInit) tPD_init(ptPD);	// new discretization time
+	
 	ptPD->fPout = ptPD->fIn * ptPD->fKp;
 	
-	ptPD->fDout = (ptPD->fPout*ptPD->fKd - ptPD->fDprevIn)/ptPD->fDtSec;
+	ptPD->fDout = (ptPD->fPout*ptPD->fKd - ptPD->fDprevIn)*ptPD->f1divDt;
 	ptPD->fDprevIn = ptPD->fPout;
 	ptPD->fDprevOut = ptPD->fDout;
 	
 	fPreOut = ptPD->fPout + ptPD->fDout;
 	
-	if(fPreOut > ptPD->fUpOutLim) fPreOut = ptPD->fUpOutLim;
-	if(fPreOut < ptPD->fLowOutLim) fPreOut = ptPD->fLowOutLim;
+	fPreOut = PID_SATF(fPreOut, ptPD->fLowOutLim, ptPD->fUpOutLim);
 	
 	ptPD->fOut = fPreOut;
 }
@@ -150,6 +181,22 @@ void tPD_rst(tPD* ptPD)
 	ptPD->fPout = 0.0f;
 }
 
+/**
+  * @brief  Initialize the PID-controller coefficients (m_calc calls it after the
+  *	    change of fDtSec, must be called after the change of the anti-windup
+  *	    settings uAwMode or fKaw).
+  * @param  ptPID: pointer to user data structure with type "tPID".               
+  * @retval None
+  */
+void tPID_init(tPID* ptPID)
+{
+	ptPID->fDtInit = ptPID->fDtSec;
+	ptPID->fHalfDt = 0.5f*ptPID->fDtSec;
+	ptPID->f1divDt = 1.0f/ptPID->fDtSec;
+	ptPID->fAwKdt = (ptPID->uAwMode == PID_AW_BACKCALC) ? ptPID->fKaw*ptPID->fDtSec : 0.0f;
+	ptPID->fAwClamp = (ptPID->uAwMode == PID_AW_CLAMP) ? 1.0f : 0.0f;
+}
+
 /**
   * @brief  Calculate and update the PID-controller output.
   * @param  ptPID: pointer to user data structure with type "tPID".               
@@ -157,25 +204,29 @@ void tPD_rst(tPD* ptPD)
   */
 void tPID_calc(tPID* ptPID)
 {
-	float fPreOut;
+	float fPreOut, fOut, fIout;
+	
+	if(ptPID->fDtSec != ptPID->fDtInit) tPID_init(ptPID);	// new discretization time
 	
 	ptPID->fPout = ptPID->fIn * ptPID->fKp;
 	
-	ptPID->fIout = ptPID->fIprevOut + 0.5f*ptPID->fDtSec*(
+	fIout = ptPID->fIprevOut + ptPID->fHalfDt*(
 			ptPID->fPout*ptPID->fKi + ptPID->fIprevIn);
 	ptPID->fIprevIn = ptPID->fPout;
-	ptPID->fIprevOut = ptPID->fIout;
 	
-	ptPID->fDout = (ptPID->fPout*ptPID->fKd - ptPID->fDprevIn)/ptPID->fDtSec;
+	ptPID->fDout = (ptPID->fPout*ptPID->fKd - ptPID->fDprevIn)*ptPID->f1divDt;
 	ptPID->fDprevIn = ptPID->fPout;
 	ptPID->fDprevOut = ptPID->fDout;
 	
-	fPreOut = ptPID->fPout + ptPID->fIout + ptPID->fDout;
+	fPreOut = ptPID->fPout + fIout + ptPID->fDout;
 	
-	if(fPreOut > ptPID->fUpOutLim) fPreOut = ptPID->fUpOutLim;
-	if(fPreOut < ptPID->fLowOutLim) fPreOut = ptPID->fLowOutLim;
+	fOut = PID_SATF(fPreOut, ptPID->fLowOutLim, ptPID->fUpOutLim);
 	
-	ptPID->fOut = fPreOut;
+	ptPID->fIout = tPID_aw(fIout, ptPID->fIprevOut, fOut - fPreOut,
+			       ptPID->fAwKdt, ptPID->fAwClamp);
+	ptPID->fIprevOut = ptPID->fIout;
+	
+	ptPID->fOut = fOut;
 }
 
 /**
@@ -196,4 +247,211 @@ void tPID_rst(tPID* ptPID)
 	ptPID->fPout = 0.0f;
 }
 
+/**
+  * @brief  Initialize the PID-controllers bank: the reciprocals of fDtSec of the
+  *	    coefficients sets (optional, m_calc recalculates them after the change
+  *	    of fDtSec of a set).
+  * @param  ptPIDbank: pointer to user data structure with type "tPIDbank".               
+  * @retval None
+  */
+void tPIDbank_init(tPIDbank* ptPIDbank)
+{
+	unsigned s;
+	
+	for(s = 0; s < PID_BANK_COEFS; s++)
+	{
+		ptPIDbank->afDtInit[s] = ptPIDbank->asCoefs[s].fDtSec;
+		ptPIDbank->afInvDt[s] = 1.0f/ptPIDbank->asCoefs[s].fDtSec;
+	}
+}
+
+/**
+  * @brief  Calculate and update the outputs of PID-controllers bank (one pass over
+  *	    the arrays without branches, the i-th controller reads the gains of its
+  *	    coefficients set "auCoefs[i]" directly).
+  * @param  ptPIDbank: pointer to user data structure with type "tPIDbank",
+  *	    uNum: count of calculated controllers [0] - [uNum - 1].
+  * @retval None
+  */
+void tPIDbank_calc(tPIDbank* ptPIDbank, unsigned uNum)
+{
+	unsigned i, s;
+	
+	if(uNum > PID_BANK_SIZE) uNum = PID_BANK_SIZE;
+	
+	// coefficients of the sets (the division only after the change of fDtSec)
+	for(s = 0; s < PID_BANK_COEFS; s++)
+	{
+		const tPIDcoefs* ptCoefs = &ptPIDbank->asCoefs[s];
+		
+		if(ptCoefs->fDtSec != ptPIDbank->afDtInit[s])
+		{
+			ptPIDbank->afDtInit[s] = ptCoefs->fDtSec;
+			ptPIDbank->afInvDt[s] = 1.0f/ptCoefs->fDtSec;
+		}
+		ptPIDbank->afHalfDt[s] = (ptCoefs->fKi != 0.0f) ? 0.5f*ptCoefs->fDtSec : 0.0f;
+		ptPIDbank->af1divDt[s] = (ptCoefs->fKd != 0.0f) ? ptPIDbank->afInvDt[s] : 0.0f;
+		ptPIDbank->afAwKdt[s] = (ptCoefs->uAwMode == PID_AW_BACKCALC) ?
+					ptCoefs->fKaw*ptCoefs->fDtSec : 0.0f;
+		ptPIDbank->afAwClamp[s] = (ptCoefs->uAwMode == PID_AW_CLAMP) ? 1.0f : 0.0f;
+	}
+	
+	for(i = 0; i < uNum; i++)
+	{
+		unsigned uSet = (ptPIDbank->auCoefs[i] < PID_BANK_COEFS) ?
+				ptPIDbank->auCoefs[i] : 0;
+		const tPIDcoefs* ptCoefs = &ptPIDbank->asCoefs[uSet];
+		float fPout = ptPIDbank->afIn[i]*ptCoefs->fKp;
+		float fIout = ptPIDbank->afIout[i] + ptPIDbank->afHalfDt[uSet]*(
+				fPout*ptCoefs->fKi + ptPIDbank->afPrevPout[i]);
+		float fDout = (fPout*ptCoefs->fKd - ptPIDbank->afPrevPout[i])*
+			      ptPIDbank->af1divDt[uSet];
+		float fPreOut = fPout + fIout + fDout;
+		float fOut;
+		
+		fOut = PID_SATF(fPreOut, ptCoefs->fLowOutLim, ptCoefs->fUpOutLim);
+		
+		ptPIDbank->afPrevPout[i] = fPout;
+		ptPIDbank->afIout[i] = tPID_aw(fIout, ptPIDbank->afIout[i], fOut - fPreOut,
+					ptPIDbank->afAwKdt[uSet], ptPIDbank->afAwClamp[uSet]);
+		ptPIDbank->afOut[i] = fOut;
+	}
+}
+
+/**
+  * @brief  Reset the internal variables of PID-controllers bank to defaults.
+  * @param  ptPIDbank: pointer to user data structure with type "tPIDbank".               
+  * @retval None
+  */
+void tPIDbank_rst(tPIDbank* ptPIDbank)
+{
+	unsigned i;
+	
+	for(i = 0; i < PID_BANK_SIZE; i++)
+	{
+		ptPIDbank->afIn[i] = 0.0f;
+		ptPIDbank->afPrevPout[i] = 0.0f;
+		ptPIDbank->afIout[i] = 0.0f;
+		ptPIDbank->afOut[i] = 0.0f;
+	}
+}
+
+/**
+  * @brief  Initialize the double-buffered coefficients set: both sets are
+  *	    initialized by the copy of user coefficients, the set [0] is active.
+  * @param  ptDb: pointer to user data structure with type "tPIDcoefsDb",
+  *	    ptCoefs: pointer to user data structure with type "tPIDcoefs".
+  * @retval None
+  */
+void tPIDcoefsDb_init(tPIDcoefsDb* ptDb, const tPIDcoefs* ptCoefs)
+{
+	ptDb->asBuf[0] = *ptCoefs;
+	ptDb->asBuf[1] = *ptCoefs;
+	ptDb->ptUsed = 0;		// the first sync takes the set [0]
+	PID_STORE_REL(ptDb->ptActive, &ptDb->asBuf[0]);
+}
+
+/**
+  * @brief  Get the back coefficients set for the update (writer side): the back set
+  *	    is refreshed by the copy of the active one.
+  * @param  ptDb: pointer to user data structure with type "tPIDcoefsDb".
+  * @retval Pointer to the back coefficients set, NULL when the previously
+  *	    published set is not taken by the reader yet (retry later).
+  */
+tPIDcoefs* tPIDcoefsDb_back(tPIDcoefsDb* ptDb)
+{
+	tPIDcoefs* ptActive = ptDb->ptActive;
+	tPIDcoefs* ptBack = (ptActive == &ptDb->asBuf[0]) ? &ptDb->asBuf[1] : &ptDb->asBuf[0];
+	
+	if(PID_LOAD_ACQ(ptDb->ptUsed) != ptActive) return 0;
+	
+	*ptBack = *ptActive;
+	return ptBack;
+}
+
+/**
+  * @brief  Publish the back coefficients set got by "tPIDcoefsDb_back" (writer
+  *	    side, the reader takes it by the next sync call).
+  * @param  ptDb: pointer to user data structure with type "tPIDcoefsDb".
+  * @retval None
+  */
+void tPIDcoefsDb_swap(tPIDcoefsDb* ptDb)
+{
+	tPIDcoefs* ptActive = ptDb->ptActive;
+	
+	PID_STORE_REL(ptDb->ptActive, (ptActive == &ptDb->asBuf[0]) ?
+		      &ptDb->asBuf[1] : &ptDb->asBuf[0]);
+}
+
+/**
+  * @brief  Take the published coefficients set to the PI-controller (reader side,
+  *	    call before "m_calc", only one pointer load when nothing is published).
+  * @param  ptPI: pointer to user data structure with type "tPI",
+  *	    ptDb: pointer to user data structure with type "tPIDcoefsDb".
+  * @retval None
+  */
+void tPI_sync(tPI* ptPI, tPIDcoefsDb* ptDb)
+{
+	tPIDcoefs* ptCoefs = PID_LOAD_ACQ(ptDb->ptActive);
+	
+	if(ptCoefs == ptDb->ptUsed) return;
+	
+	ptPI->fDtSec = ptCoefs->fDtSec;
+	ptPI->fKp = ptCoefs->fKp;
+	ptPI->fKi = ptCoefs->fKi;
+	ptPI->fUpOutLim = ptCoefs->fUpOutLim;
+	ptPI->fLowOutLim = ptCoefs->fLowOutLim;
+	ptPI->uAwMode = ptCoefs->uAwMode;
+	ptPI->fKaw = ptCoefs->fKaw;
+	tPI_init(ptPI);
+	
+	PID_STORE_REL(ptDb->ptUsed, ptCoefs);
+}
+
+/**
+  * @brief  Take the published coefficients set to the PID-controller (reader side,
+  *	    call before "m_calc", only one pointer load when nothing is published).
+  * @param  ptPID: pointer to user data structure with type "tPID",
+  *	    ptDb: pointer to user data structure with type "tPIDcoefsDb".
+  * @retval None
+  */
+void tPID_sync(tPID* ptPID, tPIDcoefsDb* ptDb)
+{
+	tPIDcoefs* ptCoefs = PID_LOAD_ACQ(ptDb->ptActive);
+	
+	if(ptCoefs == ptDb->ptUsed) return;
+	
+	ptPID->fDtSec = ptCoefs->fDtSec;
+	ptPID->fKp = ptCoefs->fKp;
+	ptPID->fKi = ptCoefs->fKi;
+	ptPID->fKd = ptCoefs->fKd;
+	ptPID->fUpOutLim = ptCoefs->fUpOutLim;
+	ptPID->fLowOutLim = ptCoefs->fLowOutLim;
+	ptPID->uAwMode = ptCoefs->uAwMode;
+	ptPID->fKaw = ptCoefs->fKaw;
+	tPID_init(ptPID);
+	
+	PID_STORE_REL(ptDb->ptUsed, ptCoefs);
+}
+
+/**
+  * @brief  Take the published coefficients set to the coefficients set uSet of the
+  *	    PID-controllers bank (reader side, call before "m_calc", the set is
+  *	    copied only when the new set is published).
+  * @param  ptPIDbank: pointer to user data structure with type "tPIDbank",
+  *	    uSet: index of the bank coefficients set,
+  *	    ptDb: pointer to user data structure with type "tPIDcoefsDb".
+  * @retval None
+  */
+void tPIDbank_sync(tPIDbank* ptPIDbank, unsigned uSet, tPIDcoefsDb* ptDb)
+{
+	tPIDcoefs* ptCoefs = PID_LOAD_ACQ(ptDb->ptActive);
+	
+	if((ptCoefs == ptDb->ptUsed) || (uSet >= PID_BANK_COEFS)) return;
+	
+	ptPIDbank->asCoefs[uSet] = *ptCoefs;
+	
+	PID_STORE_REL(ptDb->ptUsed, ptCoefs);
+}
+
 /*********************************** END OF FILE ***********************************/
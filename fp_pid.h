@@ -43,6 +43,29 @@ extern "C" {
 /* Includes -----------------------------------------------------------------------*/
 /* Exported types -----------------------------------------------------------------*/
 
+/** 
+  * @brief Anti-windup modes of the integral link (uAwMode of "tPI", "tPID" and
+  *	   "tPIDcoefs"):
+  *	   PID_AW_NONE     - integration is not limited (output clamping only);
+  *	   PID_AW_CLAMP    - conditional integration (integral link is frozen
+  *			     while the output is saturated and the integration
+  *			     drives it deeper into saturation);
+  *	   PID_AW_BACKCALC - back-calculation (the integral link is corrected by
+  *			     fKaw*(fOut - fPreOut)*fDtSec, fKaw = 1/Tt, 1/Sec).
+  */
+#define PID_AW_NONE		0
+#define PID_AW_CLAMP		1
+#define PID_AW_BACKCALC		2
+
+/**
+  * @brief Saturation of the controllers output (min, then max select, the pattern of
+  *	   the branch-free min/max instructions, e.g. minss/maxss of x86 SSE and
+  *	   vminnm/vmaxnm or vsel of Cortex-M7, the same time for all values)
+  */
+#define PID_MINF(x, y)		(((x) > (y)) ? (y) : (x))
+#define PID_MAXF(x, y)		(((x) < (y)) ? (y) : (x))
+#define PID_SATF(x, lo, hi)	PID_MAXF(PID_MINF((x), (hi)), (lo))
+
 /** 
   * @brief "Floating point P Controller Module" data structure
   */ 
@@ -72,7 +95,13 @@ typedef struct sPI
 	float fKi;			// Integral coefficient value
 	float fUpOutLim;		// Controller's output upper limit
 	float fLowOutLim;		// Controller's output lower limit
+	unsigned uAwMode;		// Anti-windup mode (PID_AW_...)
+	float fKaw;			// Back-calculation gain, 1/Sec
 // Internal variables:	
+	float fDtInit;			// fDtSec of the coefficients (0 - not calculated)
+	float fHalfDt;			// 0.5*fDtSec
+	float fAwKdt;			// fKaw*fDtSec (PID_AW_BACKCALC) or 0
+	float fAwClamp;			// 1 (PID_AW_CLAMP) or 0
 	float fPout;			// Proportional link's output
 	float fIout;			// Integral link's output
 	float fIprevIn;			// Integral link's previous input
@@ -80,6 +109,7 @@ typedef struct sPI
 // Outputs:
 	float fOut;			// Controller's output
 // Functions:
+	void  (*m_init)(struct sPI*);	// Pointer to controller's init function
 	void  (*m_calc)(struct sPI*);	// Pointer to controller's out calculator
 	void  (*m_rst)(struct sPI*);	// Pointer to controller's reset function
 } tPI;
@@ -97,6 +127,8 @@ typedef struct sPD
 	float fUpOutLim;		// Controller's output upper limit
 	float fLowOutLim;		// Controller's output lower limit
 // Internal variables:	
+	float fDtInit;			// fDtSec of the coefficients (0 - not calculated)
+	float f1divDt;			// 1/fDtSec
 	float fPout;			// Proportional link's output
 	float fDout;			// Derivative link's output
 	float fDprevIn;			// Derivative link's previous input
@@ -104,6 +136,7 @@ typedef struct sPD
 // Outputs:
 	float fOut;			// Controller's output
 // Functions:
+	void  (*m_init)(struct sPD*);	// Pointer to controller's init function
 	void  (*m_calc)(struct sPD*);	// Pointer to controller's out calculator
 	void  (*m_rst)(struct sPD*);	// Pointer to controller's reset function
 } tPD;
@@ -121,7 +154,14 @@ typedef struct sPID
 	float fKd;			// Derivative coefficient value
 	float fUpOutLim;		// Controller's output upper limit
 	float fLowOutLim;		// Controller's output lower limit
+	unsigned uAwMode;		// Anti-windup mode (PID_AW_...)
+	float fKaw;			// Back-calculation gain, 1/Sec
 // Internal variables:
+	float fDtInit;			// fDtSec of the coefficients (0 - not calculated)
+	float fHalfDt;			// 0.5*fDtSec
+	float f1divDt;			// 1/fDtSec
+	float fAwKdt;			// fKaw*fDtSec (PID_AW_BACKCALC) or 0
+	float fAwClamp;			// 1 (PID_AW_CLAMP) or 0
 	float fPout;			// Proportional link's output
 	float fIout;			// Integral link's output
 	float fDout;			// Derivative link's output
@@ -132,10 +172,85 @@ typedef struct sPID
 // Outputs:
 	float fOut;			// Controller's output
 // Functions:
+	void  (*m_init)(struct sPID*);	// Pointer to controller's init function
 	void  (*m_calc)(struct sPID*);	// Pointer to controller's out calculator
 	void  (*m_rst)(struct sPID*);	// Pointer to controller's reset function
 } tPID;
 
+/** 
+  * @brief Max count of controllers and coefficients sets stored in one "tPIDbank"
+  *	   variable, can be overridden by the user at compile time
+  */
+#ifndef PID_BANK_SIZE
+#define PID_BANK_SIZE		16
+#endif
+
+#ifndef PID_BANK_COEFS
+#define PID_BANK_COEFS		8
+#endif
+
+/** 
+  * @brief "Floating point PID Controller coefficients set" data structure
+  */ 
+typedef struct sPIDcoefs
+{
+	float fDtSec;			// Discretization time, Sec
+	float fKp;			// Proportional coefficient value
+	float fKi;			// Integral coefficient value (0 - no I-link)
+	float fKd;			// Derivative coefficient value (0 - no D-link)
+	float fUpOutLim;		// Controller's output upper limit
+	float fLowOutLim;		// Controller's output lower limit
+	unsigned uAwMode;		// Anti-windup mode (PID_AW_...)
+	float fKaw;			// Back-calculation gain, 1/Sec
+} tPIDcoefs;
+
+/** 
+  * @brief "Double-buffered PID Controller coefficients set" data structure: the
+  *	   writer (background task) prepares the back set and publishes it by the
+  *	   pointer swap, the reader (ISR) takes the new set to the controller by
+  *	   one pointer load and acknowledges it, the writer reuses the old set only
+  *	   after the acknowledge (single writer and single reader, lock-free)
+  */ 
+typedef struct sPIDcoefsDb
+{
+	tPIDcoefs asBuf[2];		// Coefficients sets (active and back)
+	tPIDcoefs* volatile ptActive;	// Pointer to active set (writer)
+	tPIDcoefs* volatile ptUsed;	// Pointer to used set (reader)
+} tPIDcoefsDb;
+
+/** 
+  * @brief "Floating point PID Controllers Bank Module" data structure. Every array
+  *	   element [i] holds the data of the i-th controller, the controllers with
+  *	   the same gains share one coefficients set referenced by index (the
+  *	   gains are not copied, the changes of the sets are used by the next
+  *	   m_calc). The math of every controller is the same as in "tP", "tPI",
+  *	   "tPD" or "tPID" (selected by the non-zero fKi and fKd of the set).
+  */ 
+typedef struct sPIDbank
+{
+// Inputs:
+	float	afIn[PID_BANK_SIZE];		// Controller's input
+	unsigned auCoefs[PID_BANK_SIZE];	// Index of controller's coefficients set
+						// (out of range - the set [0])
+	tPIDcoefs asCoefs[PID_BANK_COEFS];	// Coefficients sets
+// Internal variables:
+	float	afDtInit[PID_BANK_COEFS];	// fDtSec of afInvDt of the set
+	float	afInvDt[PID_BANK_COEFS];	// 1/fDtSec of the set
+	float	afHalfDt[PID_BANK_COEFS];	// 0.5*fDtSec of the set (0 - no I-link)
+	float	af1divDt[PID_BANK_COEFS];	// 1/fDtSec of the set (0 - no D-link)
+	float	afAwKdt[PID_BANK_COEFS];	// fKaw*fDtSec (PID_AW_BACKCALC) or 0
+	float	afAwClamp[PID_BANK_COEFS];	// 1 (PID_AW_CLAMP) or 0
+	float	afPrevPout[PID_BANK_SIZE];	// I/D-links previous input
+	float	afIout[PID_BANK_SIZE];		// Integral link's output
+// Outputs:
+	float	afOut[PID_BANK_SIZE];		// Controller's output
+// Functions:
+	void  (*m_init)(struct sPIDbank*);	// Pointer to controllers init function
+	void  (*m_calc)(struct sPIDbank*,	// Pointer to controllers out calculator
+			unsigned);
+	void  (*m_rst)(struct sPIDbank*);	// Pointer to controllers reset function
+} tPIDbank;
+
 /* Exported constants -------------------------------------------------------------*/
 
 /** 
@@ -162,10 +277,17 @@ typedef struct sPID
 	.fKi		= 0.0f,		\
 	.fUpOutLim	= 0.0f,		\
 	.fLowOutLim	= 0.0f,		\
+	.uAwMode	= PID_AW_NONE,	\
+	.fKaw		= 0.0f,		\
+	.fDtInit	= 1.0f,		\
+	.fHalfDt	= 0.5f,		\
+	.fAwKdt		= 0.0f,		\
+	.fAwClamp	= 0.0f,		\
 	.fPout		= 0.0f,		\
 	.fIout		= 0.0f,		\
 	.fIprevIn	= 0.0f,		\
 	.fIprevOut	= 0.0f,		\
+	.m_init		= tPI_init,	\
 	.m_calc		= tPI_calc,	\
 	.m_rst		= tPI_rst	\
 }
@@ -181,10 +303,13 @@ typedef struct sPID
 	.fKd		= 0.0f,		\
 	.fUpOutLim	= 0.0f,		\
 	.fLowOutLim	= 0.0f,		\
+	.fDtInit	= 1.0f,		\
+	.f1divDt	= 1.0f,		\
 	.fPout		= 0.0f,		\
 	.fDout		= 0.0f,		\
 	.fDprevIn	= 0.0f,		\
 	.fDprevOut	= 0.0f,		\
+	.m_init		= tPD_init,	\
 	.m_calc		= tPD_calc,	\
 	.m_rst		= tPD_rst	\
 }
@@ -201,6 +326,13 @@ typedef struct sPID
 	.fKd		= 0.0f,		\
 	.fUpOutLim	= 0.0f,		\
 	.fLowOutLim	= 0.0f,		\
+	.uAwMode	= PID_AW_NONE,	\
+	.fKaw		= 0.0f,		\
+	.fDtInit	= 1.0f,		\
+	.fHalfDt	= 0.5f,		\
+	.f1divDt	= 1.0f,		\
+	.fAwKdt		= 0.0f,		\
+	.fAwClamp	= 0.0f,		\
 	.fPout		= 0.0f,		\
 	.fIout		= 0.0f,		\
 	.fDout		= 0.0f,		\
@@ -208,37 +340,118 @@ typedef struct sPID
 	.fIprevOut	= 0.0f,		\
 	.fDprevIn	= 0.0f,		\
 	.fDprevOut	= 0.0f,		\
+	.m_init		= tPID_init,	\
 	.m_calc		= tPID_calc,	\
 	.m_rst		= tPID_rst	\
 }
+
+/** 
+  * @brief Initialization constant with defaults for user variables with "tPIDbank"
+  *	   type (all not listed arrays are initialized with zeros, i.e. all
+  *	   controllers use the coefficients set [0])
+  */
+#define PID_BANK_DEFAULTS {		\
+	.m_init		= tPIDbank_init,\
+	.m_calc		= tPIDbank_calc,\
+	.m_rst		= tPIDbank_rst	\
+}
 	
 /* Exported macro -----------------------------------------------------------------*/
+
+/** 
+  * @brief Ordering of the coefficients sets accesses between the writer and reader
+  *	   (release store after the update, acquire load before the use)
+  */
+#if defined(__GNUC__) || defined(__clang__)
+#define PID_LOAD_ACQ(x)		__atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define PID_STORE_REL(x, v)	__atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define PID_LOAD_ACQ(x)		(x)
+#define PID_STORE_REL(x, v)	((x) = (v))
+#endif
+
 /* Exported functions -------------------------------------------------------------*/
 
+/**
+  * @brief  Anti-windup correction of the integral link output (selects only, no
+  *	    branches): back-calculation by fAwKdt*fErr, then conditional
+  *	    integration (previous output is kept when the saturation error and
+  *	    the integration step have the opposite signs and fAwClamp = 1). Used
+  *	    by the controllers and the PI-adapters of the estimators.
+  * @param  fIout: integral link's output,
+  *	    fIprevOut: integral link's previous output,
+  *	    fErr: saturation error (clamped output - unclamped output),
+  *	    fAwKdt: back-calculation gain per step (0 - disabled),
+  *	    fAwClamp: conditional integration enable (1 or 0).
+  * @retval Corrected integral link's output.
+  */
+static inline float tPID_aw(float fIout, float fIprevOut, float fErr,
+			    float fAwKdt, float fAwClamp)
+{
+	fIout = fIout + fAwKdt*fErr;
+	return (fErr*(fIout - fIprevOut)*fAwClamp < 0.0f) ? fIprevOut : fIout;
+}
+
 /* P controller's output calculation function prototype ****************************/
 void tP_calc(tP*);
 
 /* Reset the internal variables of P cnotroller ************************************/
 void tP_rst(tP*);
 
+/* PI controller's initialization function prototype *******************************/
+void tPI_init(tPI*);
+
 /* PI controller's output calculation function prototype ***************************/
 void tPI_calc(tPI*);
 
 /* Reset the internal variables of PI cnotroller ***********************************/
 void tPI_rst(tPI*);
 
+/* PD controller's initialization function prototype *******************************/
+void tPD_init(tPD*);
+
 /* PD controller's output calculation function prototype ***************************/
 void tPD_calc(tPD*);
 
 /* Reset the internal variables of PD cnotroller ***********************************/
 void tPD_rst(tPD*);
 
+/* PID controller's initialization function prototype ******************************/
+void tPID_init(tPID*);
+
 /* PID controller's output calculation function prototype **************************/
 void tPID_calc(tPID*);
 
 /* Reset the internal variables of PID cnotroller **********************************/
 void tPID_rst(tPID*);
 
+/* PID controllers bank initialization function prototype **************************/
+void tPIDbank_init(tPIDbank*);
+
+/* PID controllers bank output calculation function prototype **********************/
+void tPIDbank_calc(tPIDbank*, unsigned);
+
+/* Reset the internal variables of PID controllers bank ****************************/
+void tPIDbank_rst(tPIDbank*);
+
+/* Double-buffered coefficients set initialization function prototype *************/
+void tPIDcoefsDb_init(tPIDcoefsDb*, const tPIDcoefs*);
+
+/* Back coefficients set (copy of the active one) for update function prototype ****/
+tPIDcoefs* tPIDcoefsDb_back(tPIDcoefsDb*);
+
+/* Publish the back coefficients set function prototype ****************************/
+void tPIDcoefsDb_swap(tPIDcoefsDb*);
+
+/* Take the published coefficients set to PI-controller function prototype *********/
+void tPI_sync(tPI*, tPIDcoefsDb*);
+
+/* Take the published coefficients set to PID-controller function prototype ********/
+void tPID_sync(tPID*, tPIDcoefsDb*);
+
+/* Take the published coefficients set to PID controllers bank function prototype **/
+void tPIDbank_sync(tPIDbank*, unsigned, tPIDcoefsDb*);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,178 @@
+/**
+  ***********************************************************************************
+  * @file    fx_math.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware function for implementation the following
+  *	     fixed point (Q31 and Q15) math functions:
+  *		+ scaled coefficients calculation from the float values;
+  *		+ vector angle and magnitude calculation by CORDIC algorithm.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "fx_math.h"
+#include <math.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+
+#define Q31_CORDIC_ITER		24	// CORDIC iterations of Q31 (resolution ~1.2e-7 Rad)
+#define Q15_CORDIC_ITER		16	// CORDIC iterations of Q15 (resolution ~3.1e-5 Rad)
+
+/* Private constants --------------------------------------------------------------*/
+
+/* atan(2^-i)/PI in Q31 format (1.0 = PI Rad) */
+static const int32_t alAtanTab[Q31_CORDIC_ITER] = {
+	0x20000000, 0x12E4051E, 0x09FB385B, 0x051111D4, 0x028B0D43, 0x0145D7E1,
+	0x00A2F61E, 0x00517C55, 0x0028BE53, 0x00145F2F, 0x000A2F98, 0x000517CC,
+	0x00028BE6, 0x000145F3, 0x0000A2FA, 0x0000517D, 0x000028BE, 0x0000145F,
+	0x00000A30, 0x00000518, 0x0000028C, 0x00000146, 0x000000A3, 0x00000051
+};
+
+/* 1/K of CORDIC algorithm in Q31 format (K = 1.646760258...) */
+#define Q31_CORDIC_1DIVK	((int32_t)1304065748)
+
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Calculate the Q31 coefficient with scaling from the float value.
+  * @param  fX: float value of coefficient (|fX| < 2^31).
+  * @retval Q31 coefficient with type "tQ31coef".
+  */
+tQ31coef q31_coef(float fX)
+{
+	tQ31coef sK;
+	int iSh = -31;
+
+	while((iSh < 31) && (fabsf(fX) >= ldexpf(1.0f, iSh))) iSh++;
+
+	sK.qM = q31_from_float(ldexpf(fX, -iSh));
+	sK.iSh = (int8_t)iSh;
+	return sK;
+}
+
+/**
+  * @brief  Calculate the Q15 coefficient with scaling from the float value.
+  * @param  fX: float value of coefficient (|fX| < 2^15).
+  * @retval Q15 coefficient with type "tQ15coef".
+  */
+tQ15coef q15_coef(float fX)
+{
+	tQ15coef sK;
+	int iSh = -15;
+
+	while((iSh < 15) && (fabsf(fX) >= ldexpf(1.0f, iSh))) iSh++;
+
+	sK.qM = q15_from_float(ldexpf(fX, -iSh));
+	sK.iSh = (int8_t)iSh;
+	return sK;
+}
+
+/**
+  * @brief  Vector angle and magnitude calculation by CORDIC (vectoring mode).
+  * @param  qY: vector component Beta,
+  *	    qX: vector component Alpha,
+  *	    pqAng: pointer to output angle (1.0 = PI Rad),
+  *	    pqMagn: pointer to output magnitude (same scale as the components),
+  *	    uIter: count of CORDIC iterations.
+  * @retval None
+  */
+static void q31_cordic(int32_t qY, int32_t qX, int32_t* pqAng, int32_t* pqMagn,
+		       unsigned uIter)
+{
+	// components are divided by 4 to prevent overflow (|v|*K < 2^31)
+	int32_t lX = qX >> 2;
+	int32_t lY = qY >> 2;
+	uint32_t uAng = 0;			// angle with wraparound (2^32 = 2*PI)
+	unsigned i;
+
+	if(lX < 0)				// rotate by PI to the right half-plane
+	{
+		lX = -lX;
+		lY = -lY;
+		uAng = 0x80000000u;
+	}
+
+	for(i = 0; i < uIter; i++)
+	{
+		int32_t lXi = lX >> i;
+		int32_t lYi = lY >> i;
+
+		if(lY > 0)
+		{
+			lX += lYi;
+			lY -= lXi;
+			uAng += (uint32_t)alAtanTab[i];
+		}
+		else
+		{
+			lX -= lYi;
+			lY += lXi;
+			uAng -= (uint32_t)alAtanTab[i];
+		}
+	}
+
+	*pqAng = (int32_t)uAng;
+	*pqMagn = q31_sat((int64_t)q31_mul(lX, Q31_CORDIC_1DIVK)*4);
+}
+
+/**
+  * @brief  Q31 vector angle and magnitude calculation.
+  * @param  qY: vector component Beta, Q31,
+  *	    qX: vector component Alpha, Q31,
+  *	    pqAng: pointer to output angle, Q31 (1.0 = PI Rad),
+  *	    pqMagn: pointer to output magnitude, Q31 (saturated to ~1.0).
+  * @retval None
+  */
+void q31_polar(int32_t qY, int32_t qX, int32_t* pqAng, int32_t* pqMagn)
+{
+	q31_cordic(qY, qX, pqAng, pqMagn, Q31_CORDIC_ITER);
+}
+
+/**
+  * @brief  Q15 vector angle and magnitude calculation.
+  * @param  qY: vector component Beta, Q15,
+  *	    qX: vector component Alpha, Q15,
+  *	    pqAng: pointer to output angle, Q15 (1.0 = PI Rad),
+  *	    pqMagn: pointer to output magnitude, Q15 (saturated to ~1.0).
+  * @retval None
+  */
+void q15_polar(int16_t qY, int16_t qX, int16_t* pqAng, int16_t* pqMagn)
+{
+	int32_t qAng, qMagn;
+
+	q31_cordic(q15_to_q31(qY), q15_to_q31(qX), &qAng, &qMagn, Q15_CORDIC_ITER);
+
+	*pqAng = q31_to_q15(qAng);
+	*pqMagn = q31_to_q15(qMagn);
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,225 @@
+/**
+  ***********************************************************************************
+  * @file    fx_math.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and inline
+  *	     functions of the fixed point (Q31 and Q15) saturating arithmetic used
+  *	     by the fixed point P/I/D controllers and induction motor estimators.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __FX_MATH_H__
+#define __FX_MATH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief Q31 coefficient with scaling: value = qM * 2^(iSh - 31), where qM is a
+  *	   Q31 mantissa and iSh (-31..31) is a count of integer bits of the value
+  */
+typedef struct sQ31coef
+{
+	int32_t		qM;			// Q31 mantissa
+	int8_t		iSh;			// Exponent (count of integer bits)
+} tQ31coef;
+
+/**
+  * @brief Q15 coefficient with scaling: value = qM * 2^(iSh - 15), where qM is a
+  *	   Q15 mantissa and iSh (-15..15) is a count of integer bits of the value
+  */
+typedef struct sQ15coef
+{
+	int16_t		qM;			// Q15 mantissa
+	int8_t		iSh;			// Exponent (count of integer bits)
+} tQ15coef;
+
+/* Exported constants -------------------------------------------------------------*/
+
+#define Q31_MAX			((int32_t)0x7FFFFFFF)	// Max Q31 value (~1.0)
+#define Q31_MIN			((int32_t)(-0x7FFFFFFF - 1))	// Min Q31 value (-1.0)
+#define Q15_MAX			((int16_t)0x7FFF)	// Max Q15 value (~1.0)
+#define Q15_MIN			((int16_t)(-0x7FFF - 1))	// Min Q15 value (-1.0)
+
+/* Exported functions -------------------------------------------------------------*/
+
+/**
+  * @brief  Saturation of 64-bit value to Q31 range.
+  */
+static inline int32_t q31_sat(int64_t llX)
+{
+	return (llX > Q31_MAX) ? Q31_MAX : ((llX < Q31_MIN) ? Q31_MIN : (int32_t)llX);
+}
+
+/**
+  * @brief  Saturation of 32-bit value to Q15 range.
+  */
+static inline int16_t q15_sat(int32_t lX)
+{
+	return (lX > Q15_MAX) ? Q15_MAX : ((lX < Q15_MIN) ? Q15_MIN : (int16_t)lX);
+}
+
+/**
+  * @brief  Saturating Q31 addition and subtraction (32-bit operations only).
+  */
+static inline int32_t q31_add(int32_t qA, int32_t qB)
+{
+	int32_t qS = (int32_t)((uint32_t)qA + (uint32_t)qB);
+
+	// overflow if both operands have the same sign and the sum has another one
+	return (((qA ^ qS) & (qB ^ qS)) < 0) ? ((qA < 0) ? Q31_MIN : Q31_MAX) : qS;
+}
+
+static inline int32_t q31_sub(int32_t qA, int32_t qB)
+{
+	int32_t qS = (int32_t)((uint32_t)qA - (uint32_t)qB);
+
+	// overflow if operands have different signs and the result has sign of qB
+	return (((qA ^ qB) & (qA ^ qS)) < 0) ? ((qA < 0) ? Q31_MIN : Q31_MAX) : qS;
+}
+
+/**
+  * @brief  Saturating Q15 addition and subtraction.
+  */
+static inline int16_t q15_add(int16_t qA, int16_t qB)
+{
+	return q15_sat((int32_t)qA + qB);
+}
+
+static inline int16_t q15_sub(int16_t qA, int16_t qB)
+{
+	return q15_sat((int32_t)qA - qB);
+}
+
+/**
+  * @brief  Saturating Q31 and Q15 multiplication.
+  */
+static inline int32_t q31_mul(int32_t qA, int32_t qB)
+{
+	return q31_sat(((int64_t)qA*qB) >> 31);
+}
+
+static inline int16_t q15_mul(int16_t qA, int16_t qB)
+{
+	return q15_sat(((int32_t)qA*qB) >> 15);
+}
+
+/**
+  * @brief  Saturating multiplication of Q31 value by scaled Q31 coefficient.
+  */
+static inline int32_t q31_mulk(int32_t qX, tQ31coef sK)
+{
+	return q31_sat(((int64_t)qX*sK.qM) >> (31 - sK.iSh));
+}
+
+/**
+  * @brief  Saturating multiplication of Q15 value by scaled Q15 coefficient.
+  */
+static inline int16_t q15_mulk(int16_t qX, tQ15coef sK)
+{
+	return q15_sat(((int32_t)qX*sK.qM) >> (15 - sK.iSh));
+}
+
+/**
+  * @brief  Saturating multiplication of Q15 value by scaled Q15 coefficient with
+  *	    Q31 result (used by the high resolution integrators of Q15 modules).
+  */
+static inline int32_t q15_mulk31(int16_t qX, tQ15coef sK)
+{
+	int32_t lP = (int32_t)qX*sK.qM;		// Q30 * 2^iSh
+
+	if(sK.iSh < 0) return lP >> (-1 - sK.iSh);
+	return q31_sat((int64_t)lP << (1 + sK.iSh));
+}
+
+/**
+  * @brief  Conversion of Q31 to Q15 and Q15 to Q31 value.
+  */
+static inline int16_t q31_to_q15(int32_t qX)
+{
+	return (int16_t)(qX >> 16);
+}
+
+static inline int32_t q15_to_q31(int16_t qX)
+{
+	return (int32_t)qX*65536;
+}
+
+/**
+  * @brief  Conversion of float value to Q31/Q15 value (with saturation) and back.
+  *	    Intended for initialization functions, not for the fast code.
+  */
+static inline int32_t q31_from_float(float fX)
+{
+	double dX = (double)fX*2147483648.0;
+
+	dX += (dX < 0.0) ? -0.5 : 0.5;
+	return (dX >= 2147483647.0) ? Q31_MAX : ((dX <= -2147483648.0) ? Q31_MIN :
+		(int32_t)dX);
+}
+
+static inline int16_t q15_from_float(float fX)
+{
+	float fY = fX*32768.0f;
+
+	fY += (fY < 0.0f) ? -0.5f : 0.5f;
+	return (fY >= 32767.0f) ? Q15_MAX : ((fY <= -32768.0f) ? Q15_MIN : (int16_t)fY);
+}
+
+static inline float q31_to_float(int32_t qX)
+{
+	return (float)qX*(1.0f/2147483648.0f);
+}
+
+static inline float q15_to_float(int16_t qX)
+{
+	return (float)qX*(1.0f/32768.0f);
+}
+
+/* Scaled coefficient from the float value *****************************************/
+tQ31coef q31_coef(float);
+tQ15coef q15_coef(float);
+
+/* Rotor flux (vector) angle and magnitude calculation by CORDIC ********************/
+void q31_polar(int32_t, int32_t, int32_t*, int32_t*);
+void q15_polar(int16_t, int16_t, int16_t*, int16_t*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FX_MATH_H__ */
+
+/*********************************** END OF FILE ***********************************/
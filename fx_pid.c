@@ -0,0 +1,453 @@
+/**
+  ***********************************************************************************
+  * @file    fx_pid.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware function for implementation the following
+  *	     types of fixed point (Q31 and Q15) controllers:
+  *		+ proportional (P) controller;
+  *		+ proportional-integral (PI) controller;
+  *		+ proportional-derivative (PD) controller;
+  *		+ proportional-integral-derivative (PID) controller.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "fx_pid.h"
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the scaled coefficients of Q31 P-controller.
+  * @param  ptP: pointer to user data structure with type "tPq31".
+  * @retval None
+  */
+void tPq31_init(tPq31* ptP)
+{
+	ptP->sKp = q31_coef(ptP->fKp*ptP->fInBase/ptP->fOutBase);
+	ptP->qUpOutLim = q31_from_float(ptP->fUpOutLim/ptP->fOutBase);
+	ptP->qLowOutLim = q31_from_float(ptP->fLowOutLim/ptP->fOutBase);
+}
+
+/**
+  * @brief  Calculate and update the Q31 P-controller output.
+  * @param  ptP: pointer to user data structure with type "tPq31".
+  * @retval None
+  */
+void tPq31_calc(tPq31* ptP)
+{
+	int32_t qPreOut;
+	
+	qPreOut = q31_mulk(ptP->qIn, ptP->sKp);
+	
+	if(qPreOut > ptP->qUpOutLim) qPreOut = ptP->qUpOutLim;
+	if(qPreOut < ptP->qLowOutLim) qPreOut = ptP->qLowOutLim;
+	
+	ptP->qOut = qPreOut;
+}
+
+/**
+  * @brief  Reset the internal variables of Q31 P-controller to defaults.
+  * @param  ptP: pointer to user data structure with type "tPq31".
+  * @retval None
+  */
+void tPq31_rst(tPq31* ptP)
+{
+	ptP->qIn = 0;
+	ptP->qOut = 0;
+}
+
+/**
+  * @brief  Initialize the scaled coefficients of Q31 PI-controller.
+  * @param  ptPI: pointer to user data structure with type "tPIq31".
+  * @retval None
+  */
+void tPIq31_init(tPIq31* ptPI)
+{
+	ptPI->sKp = q31_coef(ptPI->fKp*ptPI->fInBase/ptPI->fOutBase);
+	ptPI->sKi = q31_coef(0.5f*ptPI->fDtSec*ptPI->fKi);
+	ptPI->sHalfDt = q31_coef(0.5f*ptPI->fDtSec);
+	ptPI->qUpOutLim = q31_from_float(ptPI->fUpOutLim/ptPI->fOutBase);
+	ptPI->qLowOutLim = q31_from_float(ptPI->fLowOutLim/ptPI->fOutBase);
+}
+
+/**
+  * @brief  Calculate and update the Q31 PI-controller output.
+  * @param  ptPI: pointer to user data structure with type "tPIq31".
+  * @retval None
+  */
+void tPIq31_calc(tPIq31* ptPI)
+{
+	int32_t qPreOut;
+	
+	ptPI->qPout = q31_mulk(ptPI->qIn, ptPI->sKp);
+	
+	ptPI->qIout = q31_add(ptPI->qIout, q31_add(q31_mulk(ptPI->qPout, ptPI->sKi),
+			q31_mulk(ptPI->qIprevIn, ptPI->sHalfDt)));
+	ptPI->qIprevIn = ptPI->qPout;
+	
+	qPreOut = q31_add(ptPI->qPout, ptPI->qIout);
+	
+	if(qPreOut > ptPI->qUpOutLim) qPreOut = ptPI->qUpOutLim;
+	if(qPreOut < ptPI->qLowOutLim) qPreOut = ptPI->qLowOutLim;
+	
+	ptPI->qOut = qPreOut;
+}
+
+/**
+  * @brief  Reset the internal variables of Q31 PI-controller to defaults.
+  * @param  ptPI: pointer to user data structure with type "tPIq31".
+  * @retval None
+  */
+void tPIq31_rst(tPIq31* ptPI)
+{
+	ptPI->qIn = 0;
+	ptPI->qPout = 0;
+	ptPI->qIout = 0;
+	ptPI->qIprevIn = 0;
+	ptPI->qOut = 0;
+}
+
+/**
+  * @brief  Initialize the scaled coefficients of Q31 PD-controller.
+  * @param  ptPD: pointer to user data structure with type "tPDq31".
+  * @retval None
+  */
+void tPDq31_init(tPDq31* ptPD)
+{
+	ptPD->sKp = q31_coef(ptPD->fKp*ptPD->fInBase/ptPD->fOutBase);
+	ptPD->sKd = q31_coef(ptPD->fKd);
+	ptPD->s1divDt = q31_coef(1.0f/ptPD->fDtSec);
+	ptPD->qUpOutLim = q31_from_float(ptPD->fUpOutLim/ptPD->fOutBase);
+	ptPD->qLowOutLim = q31_from_float(ptPD->fLowOutLim/ptPD->fOutBase);
+}
+
+/**
+  * @brief  Calculate and update the Q31 PD-controller output.
+  * @param  ptPD: pointer to user data structure with type "tPDq31".
+  * @retval None
+  */
+void tPDq31_calc(tPDq31* ptPD)
+{
+	int32_t qPreOut;
+	
+	ptPD->qPout = q31_mulk(ptPD->qIn, ptPD->sKp);
+	
+	ptPD->qDout = q31_mulk(q31_sub(q31_mulk(ptPD->qPout, ptPD->sKd),
+			ptPD->qDprevIn), ptPD->s1divDt);
+	ptPD->qDprevIn = ptPD->qPout;
+	
+	qPreOut = q31_add(ptPD->qPout, ptPD->qDout);
+	
+	if(qPreOut > ptPD->qUpOutLim) qPreOut = ptPD->qUpOutLim;
+	if(qPreOut < ptPD->qLowOutLim) qPreOut = ptPD->qLowOutLim;
+	
+	ptPD->qOut = qPreOut;
+}
+
+/**
+  * @brief  Reset the internal variables of Q31 PD-controller to defaults.
+  * @param  ptPD: pointer to user data structure with type "tPDq31".
+  * @retval None
+  */
+void tPDq31_rst(tPDq31* ptPD)
+{
+	ptPD->qIn = 0;
+	ptPD->qPout = 0;
+	ptPD->qDout = 0;
+	ptPD->qDprevIn = 0;
+	ptPD->qOut = 0;
+}
+
+/**
+  * @brief  Initialize the scaled coefficients of Q31 PID-controller.
+  * @param  ptPID: pointer to user data structure with type "tPIDq31".
+  * @retval None
+  */
+void tPIDq31_init(tPIDq31* ptPID)
+{
+	ptPID->sKp = q31_coef(ptPID->fKp*ptPID->fInBase/ptPID->fOutBase);
+	ptPID->sKi = q31_coef(0.5f*ptPID->fDtSec*ptPID->fKi);
+	ptPID->sHalfDt = q31_coef(0.5f*ptPID->fDtSec);
+	ptPID->sKd = q31_coef(ptPID->fKd);
+	ptPID->s1divDt = q31_coef(1.0f/ptPID->fDtSec);
+	ptPID->qUpOutLim = q31_from_float(ptPID->fUpOutLim/ptPID->fOutBase);
+	ptPID->qLowOutLim = q31_from_float(ptPID->fLowOutLim/ptPID->fOutBase);
+}
+
+/**
+  * @brief  Calculate and update the Q31 PID-controller output.
+  * @param  ptPID: pointer to user data structure with type "tPIDq31".
+  * @retval None
+  */
+void tPIDq31_calc(tPIDq31* ptPID)
+{
+	int32_t qPreOut;
+	
+	ptPID->qPout = q31_mulk(ptPID->qIn, ptPID->sKp);
+	
+	ptPID->qIout = q31_add(ptPID->qIout, q31_add(q31_mulk(ptPID->qPout, ptPID->sKi),
+			q31_mulk(ptPID->qIprevIn, ptPID->sHalfDt)));
+	ptPID->qIprevIn = ptPID->qPout;
+	
+	ptPID->qDout = q31_mulk(q31_sub(q31_mulk(ptPID->qPout, ptPID->sKd),
+			ptPID->qDprevIn), ptPID->s1divDt);
+	ptPID->qDprevIn = ptPID->qPout;
+	
+	qPreOut = q31_add(q31_add(ptPID->qPout, ptPID->qIout), ptPID->qDout);
+	
+	if(qPreOut > ptPID->qUpOutLim) qPreOut = ptPID->qUpOutLim;
+	if(qPreOut < ptPID->qLowOutLim) qPreOut = ptPID->qLowOutLim;
+	
+	ptPID->qOut = qPreOut;
+}
+
+/**
+  * @brief  Reset the internal variables of Q31 PID-controller to defaults.
+  * @param  ptPID: pointer to user data structure with type "tPIDq31".
+  * @retval None
+  */
+void tPIDq31_rst(tPIDq31* ptPID)
+{
+	ptPID->qIn = 0;
+	ptPID->qPout = 0;
+	ptPID->qIout = 0;
+	ptPID->qIprevIn = 0;
+	ptPID->qDout = 0;
+	ptPID->qDprevIn = 0;
+	ptPID->qOut = 0;
+}
+
+/**
+  * @brief  Initialize the scaled coefficients of Q15 P-controller.
+  * @param  ptP: pointer to user data structure with type "tPq15".
+  * @retval None
+  */
+void tPq15_init(tPq15* ptP)
+{
+	ptP->sKp = q15_coef(ptP->fKp*ptP->fInBase/ptP->fOutBase);
+	ptP->qUpOutLim = q15_from_float(ptP->fUpOutLim/ptP->fOutBase);
+	ptP->qLowOutLim = q15_from_float(ptP->fLowOutLim/ptP->fOutBase);
+}
+
+/**
+  * @brief  Calculate and update the Q15 P-controller output.
+  * @param  ptP: pointer to user data structure with type "tPq15".
+  * @retval None
+  */
+void tPq15_calc(tPq15* ptP)
+{
+	int16_t qPreOut;
+	
+	qPreOut = q15_mulk(ptP->qIn, ptP->sKp);
+	
+	if(qPreOut > ptP->qUpOutLim) qPreOut = ptP->qUpOutLim;
+	if(qPreOut < ptP->qLowOutLim) qPreOut = ptP->qLowOutLim;
+	
+	ptP->qOut = qPreOut;
+}
+
+/**
+  * @brief  Reset the internal variables of Q15 P-controller to defaults.
+  * @param  ptP: pointer to user data structure with type "tPq15".
+  * @retval None
+  */
+void tPq15_rst(tPq15* ptP)
+{
+	ptP->qIn = 0;
+	ptP->qOut = 0;
+}
+
+/**
+  * @brief  Initialize the scaled coefficients of Q15 PI-controller.
+  * @param  ptPI: pointer to user data structure with type "tPIq15".
+  * @retval None
+  */
+void tPIq15_init(tPIq15* ptPI)
+{
+	ptPI->sKp = q15_coef(ptPI->fKp*ptPI->fInBase/ptPI->fOutBase);
+	ptPI->sKi = q15_coef(0.5f*ptPI->fDtSec*ptPI->fKi);
+	ptPI->sHalfDt = q15_coef(0.5f*ptPI->fDtSec);
+	ptPI->qUpOutLim = q15_from_float(ptPI->fUpOutLim/ptPI->fOutBase);
+	ptPI->qLowOutLim = q15_from_float(ptPI->fLowOutLim/ptPI->fOutBase);
+}
+
+/**
+  * @brief  Calculate and update the Q15 PI-controller output.
+  * @param  ptPI: pointer to user data structure with type "tPIq15".
+  * @retval None
+  */
+void tPIq15_calc(tPIq15* ptPI)
+{
+	int16_t qPreOut;
+	
+	ptPI->qPout = q15_mulk(ptPI->qIn, ptPI->sKp);
+	
+	ptPI->qIout = q31_add(ptPI->qIout, q31_add(q15_mulk31(ptPI->qPout, ptPI->sKi),
+			q15_mulk31(ptPI->qIprevIn, ptPI->sHalfDt)));
+	ptPI->qIprevIn = ptPI->qPout;
+	
+	qPreOut = q31_to_q15(q31_add(q15_to_q31(ptPI->qPout), ptPI->qIout));
+	
+	if(qPreOut > ptPI->qUpOutLim) qPreOut = ptPI->qUpOutLim;
+	if(qPreOut < ptPI->qLowOutLim) qPreOut = ptPI->qLowOutLim;
+	
+	ptPI->qOut = qPreOut;
+}
+
+/**
+  * @brief  Reset the internal variables of Q15 PI-controller to defaults.
+  * @param  ptPI: pointer to user data structure with type "tPIq15".
+  * @retval None
+  */
+void tPIq15_rst(tPIq15* ptPI)
+{
+	ptPI->qIn = 0;
+	ptPI->qPout = 0;
+	ptPI->qIout = 0;
+	ptPI->qIprevIn = 0;
+	ptPI->qOut = 0;
+}
+
+/**
+  * @brief  Initialize the scaled coefficients of Q15 PD-controller.
+  * @param  ptPD: pointer to user data structure with type "tPDq15".
+  * @retval None
+  */
+void tPDq15_init(tPDq15* ptPD)
+{
+	ptPD->sKp = q15_coef(ptPD->fKp*ptPD->fInBase/ptPD->fOutBase);
+	ptPD->sKd = q15_coef(ptPD->fKd);
+	ptPD->s1divDt = q15_coef(1.0f/ptPD->fDtSec);
+	ptPD->qUpOutLim = q15_from_float(ptPD->fUpOutLim/ptPD->fOutBase);
+	ptPD->qLowOutLim = q15_from_float(ptPD->fLowOutLim/ptPD->fOutBase);
+}
+
+/**
+  * @brief  Calculate and update the Q15 PD-controller output.
+  * @param  ptPD: pointer to user data structure with type "tPDq15".
+  * @retval None
+  */
+void tPDq15_calc(tPDq15* ptPD)
+{
+	int16_t qPreOut;
+	
+	ptPD->qPout = q15_mulk(ptPD->qIn, ptPD->sKp);
+	
+	ptPD->qDout = q15_mulk(q15_sub(q15_mulk(ptPD->qPout, ptPD->sKd),
+			ptPD->qDprevIn), ptPD->s1divDt);
+	ptPD->qDprevIn = ptPD->qPout;
+	
+	qPreOut = q15_add(ptPD->qPout, ptPD->qDout);
+	
+	if(qPreOut > ptPD->qUpOutLim) qPreOut = ptPD->qUpOutLim;
+	if(qPreOut < ptPD->qLowOutLim) qPreOut = ptPD->qLowOutLim;
+	
+	ptPD->qOut = qPreOut;
+}
+
+/**
+  * @brief  Reset the internal variables of Q15 PD-controller to defaults.
+  * @param  ptPD: pointer to user data structure with type "tPDq15".
+  * @retval None
+  */
+void tPDq15_rst(tPDq15* ptPD)
+{
+	ptPD->qIn = 0;
+	ptPD->qPout = 0;
+	ptPD->qDout = 0;
+	ptPD->qDprevIn = 0;
+	ptPD->qOut = 0;
+}
+
+/**
+  * @brief  Initialize the scaled coefficients of Q15 PID-controller.
+  * @param  ptPID: pointer to user data structure with type "tPIDq15".
+  * @retval None
+  */
+void tPIDq15_init(tPIDq15* ptPID)
+{
+	ptPID->sKp = q15_coef(ptPID->fKp*ptPID->fInBase/ptPID->fOutBase);
+	ptPID->sKi = q15_coef(0.5f*ptPID->fDtSec*ptPID->fKi);
+	ptPID->sHalfDt = q15_coef(0.5f*ptPID->fDtSec);
+	ptPID->sKd = q15_coef(ptPID->fKd);
+	ptPID->s1divDt = q15_coef(1.0f/ptPID->fDtSec);
+	ptPID->qUpOutLim = q15_from_float(ptPID->fUpOutLim/ptPID->fOutBase);
+	ptPID->qLowOutLim = q15_from_float(ptPID->fLowOutLim/ptPID->fOutBase);
+}
+
+/**
+  * @brief  Calculate and update the Q15 PID-controller output.
+  * @param  ptPID: pointer to user data structure with type "tPIDq15".
+  * @retval None
+  */
+void tPIDq15_calc(tPIDq15* ptPID)
+{
+	int16_t qPreOut;
+	
+	ptPID->qPout = q15_mulk(ptPID->qIn, ptPID->sKp);
+	
+	ptPID->qIout = q31_add(ptPID->qIout, q31_add(q15_mulk31(ptPID->qPout, ptPID->sKi),
+			q15_mulk31(ptPID->qIprevIn, ptPID->sHalfDt)));
+	ptPID->qIprevIn = ptPID->qPout;
+	
+	ptPID->qDout = q15_mulk(q15_sub(q15_mulk(ptPID->qPout, ptPID->sKd),
+			ptPID->qDprevIn), ptPID->s1divDt);
+	ptPID->qDprevIn = ptPID->qPout;
+	
+	qPreOut = q31_to_q15(q31_add(q31_add(q15_to_q31(ptPID->qPout),
+			ptPID->qIout), q15_to_q31(ptPID->qDout)));
+	
+	if(qPreOut > ptPID->qUpOutLim) qPreOut = ptPID->qUpOutLim;
+	if(qPreOut < ptPID->qLowOutLim) qPreOut = ptPID->qLowOutLim;
+	
+	ptPID->qOut = qPreOut;
+}
+
+/**
+  * @brief  Reset the internal variables of Q15 PID-controller to defaults.
+  * @param  ptPID: pointer to user data structure with type "tPIDq15".
+  * @retval None
+  */
+void tPIDq15_rst(tPIDq15* ptPID)
+{
+	ptPID->qIn = 0;
+	ptPID->qPout = 0;
+	ptPID->qIout = 0;
+	ptPID->qIprevIn = 0;
+	ptPID->qDout = 0;
+	ptPID->qDprevIn = 0;
+	ptPID->qOut = 0;
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,534 @@
+/**
+  ***********************************************************************************
+  * @file    fx_pid.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the fixed point (Q31 and Q15) P/I/D
+  *	     controllers.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __FX_PID_H__
+#define __FX_PID_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "fx_math.h" // Fixed point math library
+
+/* Exported types -----------------------------------------------------------------*/
+
+/*
+ * All Q31/Q15 values are the per-unit values of the base values, i.e. the physical
+ * value = Q value * base value. The float settings (gains, limits and bases) are
+ * converted to the scaled fixed point coefficients by m_init function, so the
+ * float arithmetic is used only at initialization time. The integral links keep
+ * the Q31 resolution for both Q31 and Q15 controllers.
+ */
+
+/** 
+  * @brief "Fixed point Q31 P Controller Module" data structure
+  */ 
+typedef struct sPq31
+{
+// Inputs:
+	int32_t qIn;			// Controller's input, Q31 of fInBase
+// Settings (used by m_init function only):
+	float fKp;			// Proportional coefficient value
+	float fUpOutLim;		// Controller's output upper limit
+	float fLowOutLim;		// Controller's output lower limit
+	float fInBase;			// Base value of input (1.0 in Q31)
+	float fOutBase;			// Base value of output (1.0 in Q31)
+// Internal variables:
+	tQ31coef sKp;			// Scaled proportional coefficient
+	int32_t qUpOutLim;		// Output upper limit, Q31
+	int32_t qLowOutLim;		// Output lower limit, Q31
+// Outputs:
+	int32_t qOut;			// Controller's output, Q31 of fOutBase
+// Functions:
+	void  (*m_init)(struct sPq31*);	// Pointer to initialization function
+	void  (*m_calc)(struct sPq31*);	// Pointer to controller's out calculator
+	void  (*m_rst)(struct sPq31*);	// Pointer to controller's reset function
+} tPq31;
+
+/** 
+  * @brief "Fixed point Q31 PI Controller Module" data structure
+  */ 
+typedef struct sPIq31
+{
+// Inputs:
+	int32_t qIn;			// Controller's input, Q31 of fInBase
+// Settings (used by m_init function only):
+	float fDtSec;			// Discretization time, Sec
+	float fKp;			// Proportional coefficient value
+	float fKi;			// Integral coefficient value
+	float fUpOutLim;		// Controller's output upper limit
+	float fLowOutLim;		// Controller's output lower limit
+	float fInBase;			// Base value of input (1.0 in Q31)
+	float fOutBase;			// Base value of output (1.0 in Q31)
+// Internal variables:
+	tQ31coef sKp;			// Scaled proportional coefficient
+	tQ31coef sKi;			// Scaled 0.5*fDtSec*fKi
+	tQ31coef sHalfDt;		// Scaled 0.5*fDtSec
+	int32_t qUpOutLim;		// Output upper limit, Q31
+	int32_t qLowOutLim;		// Output lower limit, Q31
+	int32_t qPout;			// Proportional link's output, Q31
+	int32_t qIout;			// Integral link's output, Q31
+	int32_t qIprevIn;		// Integral link's previous input, Q31
+// Outputs:
+	int32_t qOut;			// Controller's output, Q31 of fOutBase
+// Functions:
+	void  (*m_init)(struct sPIq31*);	// Pointer to initialization function
+	void  (*m_calc)(struct sPIq31*);	// Pointer to controller's out calculator
+	void  (*m_rst)(struct sPIq31*);	// Pointer to controller's reset function
+} tPIq31;
+
+/** 
+  * @brief "Fixed point Q31 PD Controller Module" data structure
+  */ 
+typedef struct sPDq31
+{
+// Inputs:
+	int32_t qIn;			// Controller's input, Q31 of fInBase
+// Settings (used by m_init function only):
+	float fDtSec;			// Discretization time, Sec
+	float fKp;			// Proportional coefficient value
+	float fKd;			// Derivative coefficient value
+	float fUpOutLim;		// Controller's output upper limit
+	float fLowOutLim;		// Controller's output lower limit
+	float fInBase;			// Base value of input (1.0 in Q31)
+	float fOutBase;			// Base value of output (1.0 in Q31)
+// Internal variables:
+	tQ31coef sKp;			// Scaled proportional coefficient
+	tQ31coef sKd;			// Scaled derivative coefficient
+	tQ31coef s1divDt;		// Scaled 1/fDtSec
+	int32_t qUpOutLim;		// Output upper limit, Q31
+	int32_t qLowOutLim;		// Output lower limit, Q31
+	int32_t qPout;			// Proportional link's output, Q31
+	int32_t qDout;			// Derivative link's output, Q31
+	int32_t qDprevIn;		// Derivative link's previous input, Q31
+// Outputs:
+	int32_t qOut;			// Controller's output, Q31 of fOutBase
+// Functions:
+	void  (*m_init)(struct sPDq31*);	// Pointer to initialization function
+	void  (*m_calc)(struct sPDq31*);	// Pointer to controller's out calculator
+	void  (*m_rst)(struct sPDq31*);	// Pointer to controller's reset function
+} tPDq31;
+
+/** 
+  * @brief "Fixed point Q31 PID Controller Module" data structure
+  */ 
+typedef struct sPIDq31
+{
+// Inputs:
+	int32_t qIn;			// Controller's input, Q31 of fInBase
+// Settings (used by m_init function only):
+	float fDtSec;			// Discretization time, Sec
+	float fKp;			// Proportional coefficient value
+	float fKi;			// Integral coefficient value
+	float fKd;			// Derivative coefficient value
+	float fUpOutLim;		// Controller's output upper limit
+	float fLowOutLim;		// Controller's output lower limit
+	float fInBase;			// Base value of input (1.0 in Q31)
+	float fOutBase;			// Base value of output (1.0 in Q31)
+// Internal variables:
+	tQ31coef sKp;			// Scaled proportional coefficient
+	tQ31coef sKi;			// Scaled 0.5*fDtSec*fKi
+	tQ31coef sHalfDt;		// Scaled 0.5*fDtSec
+	tQ31coef sKd;			// Scaled derivative coefficient
+	tQ31coef s1divDt;		// Scaled 1/fDtSec
+	int32_t qUpOutLim;		// Output upper limit, Q31
+	int32_t qLowOutLim;		// Output lower limit, Q31
+	int32_t qPout;			// Proportional link's output, Q31
+	int32_t qIout;			// Integral link's output, Q31
+	int32_t qIprevIn;		// Integral link's previous input, Q31
+	int32_t qDout;			// Derivative link's output, Q31
+	int32_t qDprevIn;		// Derivative link's previous input, Q31
+// Outputs:
+	int32_t qOut;			// Controller's output, Q31 of fOutBase
+// Functions:
+	void  (*m_init)(struct sPIDq31*);	// Pointer to initialization function
+	void  (*m_calc)(struct sPIDq31*);	// Pointer to controller's out calculator
+	void  (*m_rst)(struct sPIDq31*);	// Pointer to controller's reset function
+} tPIDq31;
+
+/** 
+  * @brief "Fixed point Q15 P Controller Module" data structure
+  */ 
+typedef struct sPq15
+{
+// Inputs:
+	int16_t qIn;			// Controller's input, Q15 of fInBase
+// Settings (used by m_init function only):
+	float fKp;			// Proportional coefficient value
+	float fUpOutLim;		// Controller's output upper limit
+	float fLowOutLim;		// Controller's output lower limit
+	float fInBase;			// Base value of input (1.0 in Q15)
+	float fOutBase;			// Base value of output (1.0 in Q15)
+// Internal variables:
+	tQ15coef sKp;			// Scaled proportional coefficient
+	int16_t qUpOutLim;		// Output upper limit, Q15
+	int16_t qLowOutLim;		// Output lower limit, Q15
+// Outputs:
+	int16_t qOut;			// Controller's output, Q15 of fOutBase
+// Functions:
+	void  (*m_init)(struct sPq15*);	// Pointer to initialization function
+	void  (*m_calc)(struct sPq15*);	// Pointer to controller's out calculator
+	void  (*m_rst)(struct sPq15*);	// Pointer to controller's reset function
+} tPq15;
+
+/** 
+  * @brief "Fixed point Q15 PI Controller Module" data structure
+  */ 
+typedef struct sPIq15
+{
+// Inputs:
+	int16_t qIn;			// Controller's input, Q15 of fInBase
+// Settings (used by m_init function only):
+	float fDtSec;			// Discretization time, Sec
+	float fKp;			// Proportional coefficient value
+	float fKi;			// Integral coefficient value
+	float fUpOutLim;		// Controller's output upper limit
+	float fLowOutLim;		// Controller's output lower limit
+	float fInBase;			// Base value of input (1.0 in Q15)
+	float fOutBase;			// Base value of output (1.0 in Q15)
+// Internal variables:
+	tQ15coef sKp;			// Scaled proportional coefficient
+	tQ15coef sKi;			// Scaled 0.5*fDtSec*fKi
+	tQ15coef sHalfDt;		// Scaled 0.5*fDtSec
+	int16_t qUpOutLim;		// Output upper limit, Q15
+	int16_t qLowOutLim;		// Output lower limit, Q15
+	int16_t qPout;			// Proportional link's output, Q15
+	int32_t qIout;			// Integral link's output, Q31
+	int16_t qIprevIn;		// Integral link's previous input, Q15
+// Outputs:
+	int16_t qOut;			// Controller's output, Q15 of fOutBase
+// Functions:
+	void  (*m_init)(struct sPIq15*);	// Pointer to initialization function
+	void  (*m_calc)(struct sPIq15*);	// Pointer to controller's out calculator
+	void  (*m_rst)(struct sPIq15*);	// Pointer to controller's reset function
+} tPIq15;
+
+/** 
+  * @brief "Fixed point Q15 PD Controller Module" data structure
+  */ 
+typedef struct sPDq15
+{
+// Inputs:
+	int16_t qIn;			// Controller's input, Q15 of fInBase
+// Settings (used by m_init function only):
+	float fDtSec;			// Discretization time, Sec
+	float fKp;			// Proportional coefficient value
+	float fKd;			// Derivative coefficient value
+	float fUpOutLim;		// Controller's output upper limit
+	float fLowOutLim;		// Controller's output lower limit
+	float fInBase;			// Base value of input (1.0 in Q15)
+	float fOutBase;			// Base value of output (1.0 in Q15)
+// Internal variables:
+	tQ15coef sKp;			// Scaled proportional coefficient
+	tQ15coef sKd;			// Scaled derivative coefficient
+	tQ15coef s1divDt;		// Scaled 1/fDtSec
+	int16_t qUpOutLim;		// Output upper limit, Q15
+	int16_t qLowOutLim;		// Output lower limit, Q15
+	int16_t qPout;			// Proportional link's output, Q15
+	int16_t qDout;			// Derivative link's output, Q15
+	int16_t qDprevIn;		// Derivative link's previous input, Q15
+// Outputs:
+	int16_t qOut;			// Controller's output, Q15 of fOutBase
+// Functions:
+	void  (*m_init)(struct sPDq15*);	// Pointer to initialization function
+	void  (*m_calc)(struct sPDq15*);	// Pointer to controller's out calculator
+	void  (*m_rst)(struct sPDq15*);	// Pointer to controller's reset function
+} tPDq15;
+
+/** 
+  * @brief "Fixed point Q15 PID Controller Module" data structure
+  */ 
+typedef struct sPIDq15
+{
+// Inputs:
+	int16_t qIn;			// Controller's input, Q15 of fInBase
+// Settings (used by m_init function only):
+	float fDtSec;			// Discretization time, Sec
+	float fKp;			// Proportional coefficient value
+	float fKi;			// Integral coefficient value
+	float fKd;			// Derivative coefficient value
+	float fUpOutLim;		// Controller's output upper limit
+	float fLowOutLim;		// Controller's output lower limit
+	float fInBase;			// Base value of input (1.0 in Q15)
+	float fOutBase;			// Base value of output (1.0 in Q15)
+// Internal variables:
+	tQ15coef sKp;			// Scaled proportional coefficient
+	tQ15coef sKi;			// Scaled 0.5*fDtSec*fKi
+	tQ15coef sHalfDt;		// Scaled 0.5*fDtSec
+	tQ15coef sKd;			// Scaled derivative coefficient
+	tQ15coef s1divDt;		// Scaled 1/fDtSec
+	int16_t qUpOutLim;		// Output upper limit, Q15
+	int16_t qLowOutLim;		// Output lower limit, Q15
+	int16_t qPout;			// Proportional link's output, Q15
+	int32_t qIout;			// Integral link's output, Q31
+	int16_t qIprevIn;		// Integral link's previous input, Q15
+	int16_t qDout;			// Derivative link's output, Q15
+	int16_t qDprevIn;		// Derivative link's previous input, Q15
+// Outputs:
+	int16_t qOut;			// Controller's output, Q15 of fOutBase
+// Functions:
+	void  (*m_init)(struct sPIDq15*);	// Pointer to initialization function
+	void  (*m_calc)(struct sPIDq15*);	// Pointer to controller's out calculator
+	void  (*m_rst)(struct sPIDq15*);	// Pointer to controller's reset function
+} tPIDq15;
+
+/* Exported constants -------------------------------------------------------------*/
+
+/** 
+  * @brief Initialization constant with defaults for user variables with "tPq31" type
+  */
+#define P_Q31_DEFAULTS {		\
+	.qIn		= 0,		\
+	.fKp		= 0.0f,		\
+	.fUpOutLim	= 0.0f,		\
+	.fLowOutLim	= 0.0f,		\
+	.fInBase	= 1.0f,		\
+	.fOutBase	= 1.0f,		\
+	.qOut		= 0,		\
+	.m_init		= tPq31_init,	\
+	.m_calc		= tPq31_calc,	\
+	.m_rst		= tPq31_rst	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for user variables with "tPIq31" type
+  */
+#define PI_Q31_DEFAULTS {		\
+	.qIn		= 0,		\
+	.fDtSec		= 1.0f,		\
+	.fKp		= 0.0f,		\
+	.fKi		= 0.0f,		\
+	.fUpOutLim	= 0.0f,		\
+	.fLowOutLim	= 0.0f,		\
+	.fInBase	= 1.0f,		\
+	.fOutBase	= 1.0f,		\
+	.qOut		= 0,		\
+	.m_init		= tPIq31_init,	\
+	.m_calc		= tPIq31_calc,	\
+	.m_rst		= tPIq31_rst	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for user variables with "tPDq31" type
+  */
+#define PD_Q31_DEFAULTS {		\
+	.qIn		= 0,		\
+	.fDtSec		= 1.0f,		\
+	.fKp		= 0.0f,		\
+	.fKd		= 0.0f,		\
+	.fUpOutLim	= 0.0f,		\
+	.fLowOutLim	= 0.0f,		\
+	.fInBase	= 1.0f,		\
+	.fOutBase	= 1.0f,		\
+	.qOut		= 0,		\
+	.m_init		= tPDq31_init,	\
+	.m_calc		= tPDq31_calc,	\
+	.m_rst		= tPDq31_rst	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for user variables with "tPIDq31" type
+  */
+#define PID_Q31_DEFAULTS {		\
+	.qIn		= 0,		\
+	.fDtSec		= 1.0f,		\
+	.fKp		= 0.0f,		\
+	.fKi		= 0.0f,		\
+	.fKd		= 0.0f,		\
+	.fUpOutLim	= 0.0f,		\
+	.fLowOutLim	= 0.0f,		\
+	.fInBase	= 1.0f,		\
+	.fOutBase	= 1.0f,		\
+	.qOut		= 0,		\
+	.m_init		= tPIDq31_init,	\
+	.m_calc		= tPIDq31_calc,	\
+	.m_rst		= tPIDq31_rst	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for user variables with "tPq15" type
+  */
+#define P_Q15_DEFAULTS {		\
+	.qIn		= 0,		\
+	.fKp		= 0.0f,		\
+	.fUpOutLim	= 0.0f,		\
+	.fLowOutLim	= 0.0f,		\
+	.fInBase	= 1.0f,		\
+	.fOutBase	= 1.0f,		\
+	.qOut		= 0,		\
+	.m_init		= tPq15_init,	\
+	.m_calc		= tPq15_calc,	\
+	.m_rst		= tPq15_rst	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for user variables with "tPIq15" type
+  */
+#define PI_Q15_DEFAULTS {		\
+	.qIn		= 0,		\
+	.fDtSec		= 1.0f,		\
+	.fKp		= 0.0f,		\
+	.fKi		= 0.0f,		\
+	.fUpOutLim	= 0.0f,		\
+	.fLowOutLim	= 0.0f,		\
+	.fInBase	= 1.0f,		\
+	.fOutBase	= 1.0f,		\
+	.qOut		= 0,		\
+	.m_init		= tPIq15_init,	\
+	.m_calc		= tPIq15_calc,	\
+	.m_rst		= tPIq15_rst	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for user variables with "tPDq15" type
+  */
+#define PD_Q15_DEFAULTS {		\
+	.qIn		= 0,		\
+	.fDtSec		= 1.0f,		\
+	.fKp		= 0.0f,		\
+	.fKd		= 0.0f,		\
+	.fUpOutLim	= 0.0f,		\
+	.fLowOutLim	= 0.0f,		\
+	.fInBase	= 1.0f,		\
+	.fOutBase	= 1.0f,		\
+	.qOut		= 0,		\
+	.m_init		= tPDq15_init,	\
+	.m_calc		= tPDq15_calc,	\
+	.m_rst		= tPDq15_rst	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for user variables with "tPIDq15" type
+  */
+#define PID_Q15_DEFAULTS {		\
+	.qIn		= 0,		\
+	.fDtSec		= 1.0f,		\
+	.fKp		= 0.0f,		\
+	.fKi		= 0.0f,		\
+	.fKd		= 0.0f,		\
+	.fUpOutLim	= 0.0f,		\
+	.fLowOutLim	= 0.0f,		\
+	.fInBase	= 1.0f,		\
+	.fOutBase	= 1.0f,		\
+	.qOut		= 0,		\
+	.m_init		= tPIDq15_init,	\
+	.m_calc		= tPIDq15_calc,	\
+	.m_rst		= tPIDq15_rst	\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* Q31 P controller's initialization function prototype ****************************/
+void tPq31_init(tPq31*);
+
+/* Q31 P controller's output calculation function prototype ************************/
+void tPq31_calc(tPq31*);
+
+/* Reset the internal variables of Q31 P controller ********************************/
+void tPq31_rst(tPq31*);
+
+/* Q31 PI controller's initialization function prototype ***************************/
+void tPIq31_init(tPIq31*);
+
+/* Q31 PI controller's output calculation function prototype ***********************/
+void tPIq31_calc(tPIq31*);
+
+/* Reset the internal variables of Q31 PI controller *******************************/
+void tPIq31_rst(tPIq31*);
+
+/* Q31 PD controller's initialization function prototype ***************************/
+void tPDq31_init(tPDq31*);
+
+/* Q31 PD controller's output calculation function prototype ***********************/
+void tPDq31_calc(tPDq31*);
+
+/* Reset the internal variables of Q31 PD controller *******************************/
+void tPDq31_rst(tPDq31*);
+
+/* Q31 PID controller's initialization function prototype **************************/
+void tPIDq31_init(tPIDq31*);
+
+/* Q31 PID controller's output calculation function prototype **********************/
+void tPIDq31_calc(tPIDq31*);
+
+/* Reset the internal variables of Q31 PID controller ******************************/
+void tPIDq31_rst(tPIDq31*);
+
+/* Q15 P controller's initialization function prototype ****************************/
+void tPq15_init(tPq15*);
+
+/* Q15 P controller's output calculation function prototype ************************/
+void tPq15_calc(tPq15*);
+
+/* Reset the internal variables of Q15 P controller ********************************/
+void tPq15_rst(tPq15*);
+
+/* Q15 PI controller's initialization function prototype ***************************/
+void tPIq15_init(tPIq15*);
+
+/* Q15 PI controller's output calculation function prototype ***********************/
+void tPIq15_calc(tPIq15*);
+
+/* Reset the internal variables of Q15 PI controller *******************************/
+void tPIq15_rst(tPIq15*);
+
+/* Q15 PD controller's initialization function prototype ***************************/
+void tPDq15_init(tPDq15*);
+
+/* Q15 PD controller's output calculation function prototype ***********************/
+void tPDq15_calc(tPDq15*);
+
+/* Reset the internal variables of Q15 PD controller *******************************/
+void tPDq15_rst(tPDq15*);
+
+/* Q15 PID controller's initialization function prototype **************************/
+void tPIDq15_init(tPIDq15*);
+
+/* Q15 PID controller's output calculation function prototype **********************/
+void tPIDq15_calc(tPIDq15*);
+
+/* Reset the internal variables of Q15 PID controller ******************************/
+void tPIDq15_rst(tPIDq15*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FX_PID_H__ */
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,513 @@
+/**
+  ***********************************************************************************
+  * @file    im_batch.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the offline
+  *	     batch evaluation of the induction motor (IM) rotor speed observer:
+  *		+ batched observer (one capture per lane) with the reduction of
+  *		  the summaries inside the lane loop;
+  *		+ OpenMP target offload with double buffered staging of the
+  *		  captures chunks (IM_BATCH_OFFLOAD);
+  *		+ host threads (-fopenmp) or single thread evaluation.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_batch.h"
+#include <stdlib.h>
+#include <string.h>
+#if defined(IM_BATCH_OFFLOAD) && defined(_OPENMP)
+#define IM_BATCH_TARGET
+#include <omp.h>
+#endif
+#ifdef IM_BATCH_MAIN
+#include <stdio.h>
+#endif
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+  * @brief Settings shared by all lanes (copied to the device once per kernel)
+  */
+typedef struct sIMbatchCfg
+{
+	float		fKp;			// PI-adapter proportional coef.
+	float		fKi;			// PI-adapter integral coef.
+	float		fUpOutLim;		// PI-adapter output upper limit
+	float		fLowOutLim;		// PI-adapter output lower limit
+	float		fKaw;			// PI-adapter back-calculation gain
+						// (PID_AW_BACKCALC) or 0, 1/Sec
+	float		fAwClamp;		// 1 (PID_AW_CLAMP) or 0
+	float		fFrMax;			// Upper bound of the flux histogram, Wb
+	float		fHistK;			// IM_BATCH_HIST_BINS/fFrMax
+	uint64_t	uSkip;			// Count of first samples excluded
+} tIMbatchCfg;
+
+/**
+  * @brief Accumulators of the lane statistics (the only data copied back from the
+  *	   device)
+  */
+typedef struct sIMbatchAcc
+{
+	double		dErr;			// Sum of speed errors
+	double		dErr2;			// Sum of squared speed errors
+	double		dFr;			// Sum of rotor flux magnitudes
+	uint64_t	uNum;			// Count of accumulated samples
+	float		fErrMax;		// Max abs speed error
+	uint32_t	uRef;			// 1 - the lane has reference speed
+	uint32_t	uDiverged;		// 1 - NaN/Inf state of the observer
+	uint32_t	auHist[IM_BATCH_HIST_BINS];	// Flux magnitude histogram
+} tIMbatchAcc;
+
+/* Private define -----------------------------------------------------------------*/
+
+/*
+ * Rows of the lanes state array (row r of lane i is pfSt[r*uLanes + i], so the
+ * neighbouring device threads access the neighbouring addresses):
+ */
+#define IM_BATCH_PREV_IS_AL	0	// Previous stator current Alpha, A
+#define IM_BATCH_PREV_IS_BE	1	// Previous stator current Beta, A
+#define IM_BATCH_PREV_ER_AL	2	// Previous rotor back-EMF Alpha, Volts
+#define IM_BATCH_PREV_ER_BE	3	// Previous rotor back-EMF Beta, Volts
+#define IM_BATCH_FR_AL		4	// Rotor flux Alpha, Wb
+#define IM_BATCH_FR_BE		5	// Rotor flux Beta, Wb
+#define IM_BATCH_I_PREV_IN	6	// PI-adapter integral link's previous input
+#define IM_BATCH_I_OUT		7	// PI-adapter integral link's output
+#define IM_BATCH_WR_E		8	// Rotor electrical speed, Rad/Sec
+#define IM_BATCH_HALF_DT	9	// IM parameters of the lane capture: 0.5*fDt
+#define IM_BATCH_1DIV_TR	10	// fRr/fLr
+#define IM_BATCH_1DIV_KR	11	// fLr/fLm
+#define IM_BATCH_KR_RS		12	// fRs*f1divKr
+#define IM_BATCH_KR_SIG_LS_DT	13	// fSigLs/fDt*f1divKr
+#define IM_BATCH_LM_DIV_TR	14	// fLm*f1divTr
+#define IM_BATCH_1DIV_NPP	15	// 1/fNpP
+#define IM_BATCH_ROWS		16
+
+#define IM_BATCH_LANE_IN	(IM_CAP_CHANNELS*IM_BATCH_CHUNK)	// Staged floats
+									// per lane
+
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+#ifdef IM_BATCH_TARGET
+#pragma omp declare target
+#endif
+/**
+  * @brief  Calculation of the chunk of samples of the i-th lane and accumulation
+  *	    of the lane statistics. The operations of the observer and their order
+  *	    are the same as in "tIMspeedObs_calc" with the default m_calc of the
+  *	    sub-observers and "tPI_calc" (saturation and anti-windup included).
+  * @param  pfSt: pointer to the lanes state array (IM_BATCH_ROWS rows),
+  *	    ptAcc: pointer to the accumulators of the lane,
+  *	    pfIn: pointer to the staged columns of the lane (column stride uLen),
+  *	    uLen: count of samples of the chunk,
+  *	    uLanes: count of lanes,
+  *	    i: index of the lane,
+  *	    uFirst: index of the first sample of the chunk,
+  *	    ptCfg: pointer to the settings of all lanes.
+  * @retval None
+  */
+static void tIMbatch_lane(float* IM_RESTRICT pfSt, tIMbatchAcc* IM_RESTRICT ptAcc,
+			  const float* IM_RESTRICT pfIn, unsigned uLen, unsigned uLanes,
+			  unsigned i, uint64_t uFirst, const tIMbatchCfg* IM_RESTRICT ptCfg)
+{
+	const float* pfUsAl = pfIn + IM_CAP_CH_USAL*uLen;
+	const float* pfUsBe = pfIn + IM_CAP_CH_USBE*uLen;
+	const float* pfIsAl = pfIn + IM_CAP_CH_ISAL*uLen;
+	const float* pfIsBe = pfIn + IM_CAP_CH_ISBE*uLen;
+	const float* pfWrRef = pfIn + IM_CAP_CH_WRREF*uLen;
+	float* pfLane = pfSt + i;
+	const float fHalfDt = pfLane[IM_BATCH_HALF_DT*uLanes];
+	const float f1divTr = pfLane[IM_BATCH_1DIV_TR*uLanes];
+	const float f1divKr = pfLane[IM_BATCH_1DIV_KR*uLanes];
+	const float fKrRs = pfLane[IM_BATCH_KR_RS*uLanes];
+	const float fKrSigLsDivDt = pfLane[IM_BATCH_KR_SIG_LS_DT*uLanes];
+	const float fLmDivTr = pfLane[IM_BATCH_LM_DIV_TR*uLanes];
+	const float f1divNpP = pfLane[IM_BATCH_1DIV_NPP*uLanes];
+	const float fAwKdt = ptCfg->fKaw*(2.0f*fHalfDt);	// fKaw*fDt of the lane
+	float fPrevIsAl = pfLane[IM_BATCH_PREV_IS_AL*uLanes];
+	float fPrevIsBe = pfLane[IM_BATCH_PREV_IS_BE*uLanes];
+	float fPrevErAl = pfLane[IM_BATCH_PREV_ER_AL*uLanes];
+	float fPrevErBe = pfLane[IM_BATCH_PREV_ER_BE*uLanes];
+	float fFrAl = pfLane[IM_BATCH_FR_AL*uLanes];
+	float fFrBe = pfLane[IM_BATCH_FR_BE*uLanes];
+	float fIprevIn = pfLane[IM_BATCH_I_PREV_IN*uLanes];
+	float fIout = pfLane[IM_BATCH_I_OUT*uLanes];
+	float fWrE = pfLane[IM_BATCH_WR_E*uLanes];
+	float fErr = 0.0f, fErr2 = 0.0f, fFr = 0.0f, fErrMax = ptAcc->fErrMax;
+	unsigned k, uNum = 0;
+	
+	for(k = 0; k < uLen; k++)
+	{
+		float fIsAl = pfIsAl[k];
+		float fIsBe = pfIsBe[k];
+		float fDiffIsAl, fDiffIsBe, fEsAl, fEsBe, fErAl, fErBe, fPout, fPreOut;
+		float fInt;
+		
+		// stator back-EMF observer
+		fDiffIsAl = fIsAl - fPrevIsAl;
+		fDiffIsBe = fIsBe - fPrevIsBe;
+		fPrevIsAl = fIsAl;
+		fPrevIsBe = fIsBe;
+		
+		fEsAl = pfUsAl[k]*f1divKr - fKrRs*fIsAl - fKrSigLsDivDt*fDiffIsAl;
+		fEsBe = pfUsBe[k]*f1divKr - fKrRs*fIsBe - fKrSigLsDivDt*fDiffIsBe;
+		
+		// rotor back-EMF and flux observer
+		fErAl = fIsAl*fLmDivTr - fFrAl*f1divTr - fWrE*fFrBe;
+		fFrAl = fFrAl + fHalfDt*(fErAl + fPrevErAl);
+		fPrevErAl = fErAl;
+		
+		fErBe = fIsBe*fLmDivTr - fFrBe*f1divTr + fWrE*fFrAl;
+		fFrBe = fFrBe + fHalfDt*(fErBe + fPrevErBe);
+		fPrevErBe = fErBe;
+		
+		// PI-adapter of rotor speed
+		fPout = (fIsAl*(fEsBe - fErBe) - fIsBe*(fEsAl - fErAl))*ptCfg->fKp;
+		fInt = fIout + fHalfDt*(fPout*ptCfg->fKi + fIprevIn);
+		fIprevIn = fPout;
+		
+		fPreOut = fPout + fInt;
+		fWrE = PID_SATF(fPreOut, ptCfg->fLowOutLim, ptCfg->fUpOutLim);
+		fIout = tPID_aw(fInt, fIout, fWrE - fPreOut, fAwKdt, ptCfg->fAwClamp);
+		
+		// statistics of the lane
+		if(uFirst + k >= ptCfg->uSkip)
+		{
+			float fFrMagn = sqrtf(fFrAl*fFrAl + fFrBe*fFrBe);
+			unsigned uBin = IM_BATCH_HIST_BINS - 1;
+			
+			// NaN and values out of range are counted by the last bin
+			if(fFrMagn < ptCfg->fFrMax)
+			{
+				uBin = (unsigned)(fFrMagn*ptCfg->fHistK);
+				if(uBin >= IM_BATCH_HIST_BINS) uBin = IM_BATCH_HIST_BINS - 1;
+			}
+			ptAcc->auHist[uBin]++;
+			fFr += fFrMagn;
+			
+			if(ptAcc->uRef)
+			{
+				float fE = fWrE*f1divNpP - pfWrRef[k];
+				
+				fErr += fE;
+				fErr2 += fE*fE;
+				if(fabsf(fE) > fErrMax) fErrMax = fabsf(fE);
+			}
+			uNum++;
+		}
+	}
+	
+	// chunk sums (float) are accumulated in double over the whole capture
+	ptAcc->dErr += (double)fErr;
+	ptAcc->dErr2 += (double)fErr2;
+	ptAcc->dFr += (double)fFr;
+	ptAcc->uNum += uNum;
+	ptAcc->fErrMax = fErrMax;
+	if(!isfinite(fWrE) || !isfinite(fFrAl) || !isfinite(fFrBe)) ptAcc->uDiverged = 1;
+	
+	pfLane[IM_BATCH_PREV_IS_AL*uLanes] = fPrevIsAl;
+	pfLane[IM_BATCH_PREV_IS_BE*uLanes] = fPrevIsBe;
+	pfLane[IM_BATCH_PREV_ER_AL*uLanes] = fPrevErAl;
+	pfLane[IM_BATCH_PREV_ER_BE*uLanes] = fPrevErBe;
+	pfLane[IM_BATCH_FR_AL*uLanes] = fFrAl;
+	pfLane[IM_BATCH_FR_BE*uLanes] = fFrBe;
+	pfLane[IM_BATCH_I_PREV_IN*uLanes] = fIprevIn;
+	pfLane[IM_BATCH_I_OUT*uLanes] = fIout;
+	pfLane[IM_BATCH_WR_E*uLanes] = fWrE;
+}
+#ifdef IM_BATCH_TARGET
+#pragma omp end declare target
+#endif
+
+/**
+  * @brief  Initial state, IM parameters and accumulators of the lanes.
+  * @param  ptBatch: pointer to user data structure with type "tIMbatch",
+  *	    pfSt: pointer to the lanes state array,
+  *	    ptAcc: pointer to the accumulators array.
+  * @retval Max count of samples of the captures.
+  */
+static uint64_t tIMbatch_init(const tIMbatch* ptBatch, float* pfSt, tIMbatchAcc* ptAcc)
+{
+	unsigned uLanes = ptBatch->uLanes, i, r;
+	uint64_t uMax = 0;
+	
+	for(i = 0; i < uLanes; i++)
+	{
+		const tIMcapture* ptCap = &ptBatch->ptCap[i];
+		const tIMparams* ptIMparams = &ptCap->sIMparams;
+		
+		for(r = 0; r <= IM_BATCH_WR_E; r++) pfSt[r*uLanes + i] = 0.0f;
+		pfSt[IM_BATCH_HALF_DT*uLanes + i] = ptIMparams->fHalfDt;
+		pfSt[IM_BATCH_1DIV_TR*uLanes + i] = ptIMparams->f1divTr;
+		pfSt[IM_BATCH_1DIV_KR*uLanes + i] = ptIMparams->f1divKr;
+		pfSt[IM_BATCH_KR_RS*uLanes + i] = ptIMparams->fKrRs;
+		pfSt[IM_BATCH_KR_SIG_LS_DT*uLanes + i] = ptIMparams->fKrSigLsDivDt;
+		pfSt[IM_BATCH_LM_DIV_TR*uLanes + i] = ptIMparams->fLmDivTr;
+		pfSt[IM_BATCH_1DIV_NPP*uLanes + i] = 1.0f/ptIMparams->fNpP;
+		
+		memset(&ptAcc[i], 0, sizeof(tIMbatchAcc));
+		ptAcc[i].uRef = (ptCap->uChannels > IM_CAP_CH_WRREF) ? 1u : 0u;
+		if(ptCap->uNum > uMax) uMax = ptCap->uNum;
+	}
+	return uMax;
+}
+
+/**
+  * @brief  Batch evaluation of the speed observer over all captures: the lanes are
+  *	    calculated chunk by chunk, every lane accumulates its statistics. With
+  *	    IM_BATCH_OFFLOAD the state and accumulators of the lanes stay on the
+  *	    device for the whole run, the chunks of the captures are staged by
+  *	    the host in two buffers (the next chunk is converted while the device
+  *	    calculates the current one) and only the accumulators are copied back.
+  *	    Without it every host thread takes whole captures (lanes).
+  * @param  ptBatch: pointer to user data structure with type "tIMbatch".
+  * @retval 0 - success, -1 - not valid inputs or memory allocation error.
+  */
+int tIMbatch_run(tIMbatch* ptBatch)
+{
+	unsigned uLanes = ptBatch->uLanes;
+	const tIMcapture* ptCap = ptBatch->ptCap;
+	tIMbatchCfg sCfg;
+	float* pfSt;
+	float* pfIn;
+	unsigned* puLen;
+	tIMbatchAcc* ptAcc;
+	uint64_t uMax;
+	unsigned i, b;
+	
+	ptBatch->uSamples = 0;
+	ptBatch->uDiverged = 0;
+	if((uLanes == 0) || (ptCap == 0) || (ptBatch->ptRes == 0) ||
+	   !(ptBatch->fFrMax > 0.0f)) return -1;
+	
+	sCfg.fKp = ptBatch->sPI.fKp;
+	sCfg.fKi = ptBatch->sPI.fKi;
+	sCfg.fUpOutLim = ptBatch->sPI.fUpOutLim;
+	sCfg.fLowOutLim = ptBatch->sPI.fLowOutLim;
+	sCfg.fKaw = (ptBatch->sPI.uAwMode == PID_AW_BACKCALC) ? ptBatch->sPI.fKaw : 0.0f;
+	sCfg.fAwClamp = (ptBatch->sPI.uAwMode == PID_AW_CLAMP) ? 1.0f : 0.0f;
+	sCfg.fFrMax = ptBatch->fFrMax;
+	sCfg.fHistK = (float)IM_BATCH_HIST_BINS/ptBatch->fFrMax;
+	sCfg.uSkip = ptBatch->uSkip;
+	
+	// two staging buffers of the offload, one chunk per lane of the host threads
+#ifdef IM_BATCH_TARGET
+	b = 2;
+#else
+	b = 1;
+#endif
+	pfSt = (float*)malloc((size_t)IM_BATCH_ROWS*uLanes*sizeof(float));
+	ptAcc = (tIMbatchAcc*)malloc((size_t)uLanes*sizeof(tIMbatchAcc));
+	pfIn = (float*)malloc((size_t)b*uLanes*IM_BATCH_LANE_IN*sizeof(float));
+	puLen = (unsigned*)malloc((size_t)b*uLanes*sizeof(unsigned));
+	if(!pfSt || !ptAcc || !pfIn || !puLen)
+	{
+		free(pfSt);
+		free(ptAcc);
+		free(pfIn);
+		free(puLen);
+		return -1;
+	}
+	
+	uMax = tIMbatch_init(ptBatch, pfSt, ptAcc);
+	
+#ifdef IM_BATCH_TARGET
+	{
+		const size_t szSt = (size_t)IM_BATCH_ROWS*uLanes;
+		const size_t szIn = (size_t)uLanes*IM_BATCH_LANE_IN;
+		int iDev = (ptBatch->iDevice < 0) ? omp_get_default_device() : ptBatch->iDevice;
+		uint64_t uFirst;
+		
+		#pragma omp target enter data map(to: pfSt[0:szSt], ptAcc[0:uLanes]) device(iDev)
+		
+		#pragma omp parallel
+		#pragma omp single
+		for(uFirst = 0, b = 0; uFirst < uMax; uFirst += IM_BATCH_CHUNK, b ^= 1)
+		{
+			float* pfBuf = pfIn + b*szIn;
+			unsigned* puBuf = puLen + b*uLanes;
+			
+			// staging of the chunk waits for the kernel which used the buffer
+			#pragma omp task depend(out: pfBuf[0]) firstprivate(pfBuf, puBuf, uFirst)
+			{
+				unsigned j;
+				
+				for(j = 0; j < uLanes; j++)
+				{
+					tIMdataset sData;
+					
+					puBuf[j] = (unsigned)tIMcapture_read(&ptCap[j], uFirst,
+							IM_BATCH_CHUNK, pfBuf + (size_t)j*IM_BATCH_LANE_IN,
+							&sData);
+				}
+			}
+			
+			#pragma omp target teams distribute parallel for nowait device(iDev) \
+				depend(in: pfBuf[0]) depend(inout: pfSt[0]) \
+				map(to: pfBuf[0:szIn], puBuf[0:uLanes], sCfg) \
+				firstprivate(uFirst, uLanes)
+			for(i = 0; i < uLanes; i++)
+			{
+				if(puBuf[i])
+					tIMbatch_lane(pfSt, &ptAcc[i], pfBuf + (size_t)i*IM_BATCH_LANE_IN,
+						      puBuf[i], uLanes, i, uFirst, &sCfg);
+			}
+		}
+		
+		#pragma omp target exit data map(from: ptAcc[0:uLanes]) \
+			map(release: pfSt[0:szSt]) device(iDev)
+	}
+#else
+	#ifdef _OPENMP
+	#pragma omp parallel for schedule(dynamic, 1)
+	#endif
+	for(i = 0; i < uLanes; i++)
+	{
+		float* pfBuf = pfIn + (size_t)i*IM_BATCH_LANE_IN;
+		uint64_t uFirst;
+		tIMdataset sData;
+		
+		for(uFirst = 0; uFirst < ptCap[i].uNum; uFirst += IM_BATCH_CHUNK)
+		{
+			puLen[i] = (unsigned)tIMcapture_read(&ptCap[i], uFirst, IM_BATCH_CHUNK,
+							     pfBuf, &sData);
+			tIMbatch_lane(pfSt, &ptAcc[i], pfBuf, puLen[i], uLanes, i, uFirst, &sCfg);
+		}
+	}
+#endif
+	(void)uMax;
+	
+	for(i = 0; i < uLanes; i++)
+	{
+		const tIMbatchAcc* ptA = &ptAcc[i];
+		tIMbatchRes* ptRes = &ptBatch->ptRes[i];
+		double dNum = (ptA->uNum > 0) ? (double)ptA->uNum : 1.0;
+		
+		ptRes->uNum = ptA->uNum;
+		ptRes->fErrMean = (float)(ptA->dErr/dNum);
+		ptRes->fErrRms = (float)sqrt(ptA->dErr2/dNum);
+		ptRes->fErrMax = ptA->fErrMax;
+		ptRes->fFrMean = (float)(ptA->dFr/dNum);
+		ptRes->iDiverged = (int)ptA->uDiverged;
+		memcpy(ptRes->auFrHist, ptA->auHist, sizeof(ptRes->auFrHist));
+		
+		ptBatch->uSamples += ptCap[i].uNum;
+		ptBatch->uDiverged += ptA->uDiverged;
+	}
+	
+	free(pfSt);
+	free(ptAcc);
+	free(pfIn);
+	free(puLen);
+	return 0;
+}
+
+/**
+  * @brief  Count of available OpenMP target devices.
+  * @param  None
+  * @retval Count of devices (0 - built without IM_BATCH_OFFLOAD or no device, the
+  *	    lanes run on the host).
+  */
+unsigned tIMbatch_devices(void)
+{
+#ifdef IM_BATCH_TARGET
+	return (unsigned)omp_get_num_devices();
+#else
+	return 0;
+#endif
+}
+
+#ifdef IM_BATCH_MAIN
+/**
+  * @brief  Batch evaluation program: one line of the summary per capture file.
+  *	    Usage: im_batch fKp fKi fWrMax uSkip a.imc [b.imc ...]
+  *	    (fWrMax - PI-adapter output limit, electrical Rad/Sec).
+  * @param  argc: count of arguments,
+  *	    argv: arguments.
+  * @retval 0 - success.
+  */
+int main(int argc, char** argv)
+{
+	tIMbatch sBatch = IM_BATCH_DEFAULTS;
+	tIMcapture* ptCap;
+	tIMbatchRes* ptRes;
+	unsigned uNum = 0, i;
+	int iRes;
+	
+	if(argc < 6)
+	{
+		fprintf(stderr, "usage: %s fKp fKi fWrMax uSkip a.imc [b.imc ...]\n", argv[0]);
+		return 1;
+	}
+	ptCap = (tIMcapture*)malloc((size_t)(argc - 5)*sizeof(tIMcapture));
+	ptRes = (tIMbatchRes*)malloc((size_t)(argc - 5)*sizeof(tIMbatchRes));
+	if(!ptCap || !ptRes) { free(ptCap); free(ptRes); return 1; }
+	for(i = 5; i < (unsigned)argc; i++)
+	{
+		if(tIMcapture_open(&ptCap[uNum], argv[i]) != 0)
+		{
+			fprintf(stderr, "%s: not valid capture\n", argv[i]);
+			continue;
+		}
+		argv[5 + uNum++] = argv[i];
+	}
+	
+	sBatch.ptCap = ptCap;
+	sBatch.uLanes = uNum;
+	sBatch.sPI.fKp = strtof(argv[1], 0);
+	sBatch.sPI.fKi = strtof(argv[2], 0);
+	sBatch.sPI.fUpOutLim = strtof(argv[3], 0);
+	sBatch.sPI.fLowOutLim = -sBatch.sPI.fUpOutLim;
+	sBatch.uSkip = strtoull(argv[4], 0, 10);
+	sBatch.ptRes = ptRes;
+	
+	iRes = sBatch.m_run(&sBatch);
+	for(i = 0; (iRes == 0) && (i < uNum); i++)
+	{
+		printf("%s: %llu samples, err mean %.4f rms %.4f max %.4f rad/s, flux %.4f Wb%s\n",
+		       argv[5 + i], (unsigned long long)ptRes[i].uNum, ptRes[i].fErrMean,
+		       ptRes[i].fErrRms, ptRes[i].fErrMax, ptRes[i].fFrMean,
+		       ptRes[i].iDiverged ? ", diverged" : "");
+	}
+	if(iRes == 0)
+		printf("%u captures, %llu samples, %u diverged, %u devices\n", uNum,
+		       (unsigned long long)sBatch.uSamples, sBatch.uDiverged,
+		       tIMbatch_devices());
+	
+	for(i = 0; i < uNum; i++) tIMcapture_close(&ptCap[i]);
+	free(ptCap);
+	free(ptRes);
+	return iRes ? 1 : 0;
+}
+#endif /* IM_BATCH_MAIN */
+
+/*********************************** END OF FILE ***********************************/
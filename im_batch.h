@@ -0,0 +1,147 @@
+/**
+  ***********************************************************************************
+  * @file    im_batch.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the offline batch evaluation of the
+  *	     induction motor (IM) rotor speed observer over many captures:
+  *		+ one capture (motor) per lane of the batched observer;
+  *		+ OpenMP target offload (IM_BATCH_OFFLOAD) or host threads;
+  *		+ speed error statistics and rotor flux magnitude histogram
+  *		  reduced on the device (only the summaries are copied back).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_BATCH_H__
+#define __IM_BATCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_capture.h" // Binary capture files of the datasets
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Define the IM_BATCH_OFFLOAD at compile time to run the observers on the
+  *	   OpenMP target device (e.g. "gcc -fopenmp -foffload=nvptx-none" or
+  *	   "clang -fopenmp -fopenmp-targets=nvptx64"), without it the lanes are
+  *	   calculated by the host threads (-fopenmp) or by the single thread.
+  *	   IM_BATCH_CHUNK is the count of samples of every lane copied to the
+  *	   device at once, IM_BATCH_HIST_BINS is the count of bins of the rotor
+  *	   flux magnitude histogram (the last bin accumulates all greater values).
+  *	   Define the IM_BATCH_MAIN at compile time to build the batch evaluation
+  *	   program from "im_batch.c".
+  */
+#ifndef IM_BATCH_CHUNK
+#define IM_BATCH_CHUNK		1024
+#endif
+
+#ifndef IM_BATCH_HIST_BINS
+#define IM_BATCH_HIST_BINS	32
+#endif
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "Summary of the capture" data structure (speed errors are mechanical,
+  *	   the error statistics are zeros without the reference speed channel)
+  */
+typedef struct sIMbatchRes
+{
+	uint64_t	uNum;			// Count of samples of the statistics
+	float		fErrMean;		// Speed error mean, Rad/Sec
+	float		fErrRms;		// Speed error RMS, Rad/Sec
+	float		fErrMax;		// Speed error max abs value, Rad/Sec
+	float		fFrMean;		// Rotor flux magnitude mean, Wb
+	int		iDiverged;		// 1 - observer diverged (NaN/Inf state)
+	uint32_t	auFrHist[IM_BATCH_HIST_BINS];	// Rotor flux magnitude
+							// histogram (0...fFrMax)
+} tIMbatchRes;
+
+/**
+  * @brief "IM speed observer offline batch evaluation Module" data structure. Every
+  *	   lane is the observer of one capture with its own IM parameters (header
+  *	   of the capture), the math of every lane is the same as in "tIMspeedObs"
+  *	   (default m_calc of the sub-observers, full rate, no angle tracking).
+  */
+typedef struct sIMbatch
+{
+// Inputs:
+	const tIMcapture* ptCap;		// Pointer to array of opened captures
+	unsigned	uLanes;			// Count of captures (lanes)
+	tPI		sPI;			// PI-adapter settings (fKp, fKi, output
+						// limits, anti-windup) of all lanes
+	uint64_t	uSkip;			// Count of first samples excluded from
+						// the statistics (convergence time)
+	float		fFrMax;			// Upper bound of the flux histogram, Wb
+	int		iDevice;		// OpenMP target device (IM_BATCH_OFFLOAD,
+						// -1 - default device)
+	tIMbatchRes*	ptRes;			// Pointer to summaries array (uLanes)
+// Outputs:
+	uint64_t	uSamples;		// Count of calculated samples (all lanes)
+	unsigned	uDiverged;		// Count of diverged lanes
+// Functions:
+	int	(*m_run)(struct sIMbatch*);	// Pointer to batch evaluation function
+} tIMbatch;
+
+/**
+  * @brief Initialization constant with defaults for "tIMbatch" user variables
+  */
+#define IM_BATCH_DEFAULTS {			\
+	.ptCap		= 0,			\
+	.uLanes		= 0,			\
+	.sPI		= PI_DEFAULTS,		\
+	.uSkip		= 0,			\
+	.fFrMax		= 2.0f,			\
+	.iDevice	= -1,			\
+	.ptRes		= 0,			\
+	.uSamples	= 0,			\
+	.uDiverged	= 0,			\
+	.m_run		= tIMbatch_run		\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* Batch evaluation of the speed observer over all captures ************************/
+int tIMbatch_run(tIMbatch*);
+
+/* Count of available OpenMP target devices (0 - the lanes run on the host) ********/
+unsigned tIMbatch_devices(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_BATCH_H__ */
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,692 @@
+/**
+  ***********************************************************************************
+  * @file    im_bench.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the benchmark
+  *	     of the estimators and P/I/D controllers calculation functions:
+  *		+ float, batched (SIMD) and fixed point (Q31/Q15) estimators;
+  *		+ float and fixed point P/I/D controllers;
+  *		+ results table and JSON output;
+  *		+ host benchmark program (IM_BENCH_MAIN).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#if !defined(_POSIX_C_SOURCE) || (_POSIX_C_SOURCE < 199309L)
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE		199309L	// clock_gettime() of the host counter
+#endif
+#include "im_bench.h"
+#include "im_speed_obs_bank.h"
+#include "im_estimators_fx.h"
+#include "im_foc.h"
+#include "im_ekf.h"
+#include "im_flux_obs.h"
+#include "im_plant.h"
+#include "im_startup.h"
+#include "im_state.h"
+#ifdef IM_WCET_PROFILE
+#include "im_wcet.h"
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+  * @brief Benchmark case data structure
+  */
+typedef struct sIMbenchCase
+{
+	const char*	pcName;			// Name of the function
+	void		(*m_step)(unsigned);	// Step function (k - sample index)
+	unsigned	uSteps;			// Count of steps per call
+} tIMbenchCase;
+
+/* Private define -----------------------------------------------------------------*/
+
+#define IM_BENCH_SIG		64	// Length of the input signals table (2^n)
+#define IM_BENCH_BLOCK		64	// Count of samples of the block function call
+
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+
+/* input signals tables (float, Q31 and Q15 per-unit values) */
+static float afUsAl[IM_BENCH_SIG], afUsBe[IM_BENCH_SIG];
+static float afIsAl[IM_BENCH_SIG], afIsBe[IM_BENCH_SIG];
+static int32_t aqUsAl31[IM_BENCH_SIG], aqUsBe31[IM_BENCH_SIG];
+static int32_t aqIsAl31[IM_BENCH_SIG], aqIsBe31[IM_BENCH_SIG];
+static int16_t aqUsAl15[IM_BENCH_SIG], aqUsBe15[IM_BENCH_SIG];
+static int16_t aqIsAl15[IM_BENCH_SIG], aqIsBe15[IM_BENCH_SIG];
+static float afWrE[IM_BENCH_BLOCK];
+
+/* estimators and controllers under test */
+static tIMparams sIMparams = IM_PARAMS_DEFAULTS;
+static tIMstatObs sIMstatObs = IM_STAT_OBS_DEFAULTS;
+static tIMstatObs sIMstatObsFilt = IM_STAT_OBS_DEFAULTS;
+static tIMrotObs sIMrotObs = IM_ROT_OBS_DEFAULTS;
+static tIMrotObs asIMrotObsDisc[4] = {IM_ROT_OBS_DEFAULTS, IM_ROT_OBS_DEFAULTS,
+				      IM_ROT_OBS_DEFAULTS, IM_ROT_OBS_DEFAULTS};
+static IM_ROT_LUT_SECTION tIMrotLut sIMrotLut = IM_ROT_LUT_DEFAULTS;
+static tIMspeedObs sIMspeedObs = IM_SPEED_OBS_DEFAULTS;
+static tIMspeedObs sIMspeedObsBound = IM_SPEED_OBS_DEFAULTS;
+static tIMfoc sIMfoc = IM_FOC_DEFAULTS;
+static tIMekf sIMekf = IM_EKF_DEFAULTS;
+static tIMfluxObs sIMluenObs = IM_FLUX_OBS_LUEN_DEFAULTS;
+static tIMfluxObs sIMsmObs = IM_FLUX_OBS_SMO_DEFAULTS;
+static tIMspeedObs sIMspeedObsStart = IM_SPEED_OBS_DEFAULTS;
+static tIMstartup sIMstartup = IM_STARTUP_DEFAULTS;
+static tIMplantBank sIMplant = IM_PLANT_BANK_DEFAULTS;
+static tIMprofile sIMprofile = {.uNum = 2, .afT = {0.0f, 1.0f},
+				.afWs = {0.0f, 314.0f}, .afTl = {0.0f, 1.0f}};
+static tIMspeedObsBank sIMbank = IM_SPEED_OBS_BANK_DEFAULTS;
+static tIMparams asIMparamsTab[2];
+static uint8_t au8BankState[sizeof(tIMstateHdr) + sizeof(tIMspeedObsBank)];
+static size_t szBankState;
+static tP sP = P_DEFAULTS;
+static tPI sPI = PI_DEFAULTS;
+static tPD sPD = PD_DEFAULTS;
+static tPID sPID = PID_DEFAULTS;
+static tPIDbank sPIDbank = PID_BANK_DEFAULTS;
+static tIMparamsQ31 sIMparamsQ31 = IM_PARAMS_Q31_DEFAULTS;
+static tIMspeedObsQ31 sIMspeedObsQ31 = IM_SPEED_OBS_Q31_DEFAULTS;
+static tIMparamsQ15 sIMparamsQ15 = IM_PARAMS_Q15_DEFAULTS;
+static tIMspeedObsQ15 sIMspeedObsQ15 = IM_SPEED_OBS_Q15_DEFAULTS;
+static tPIDq31 sPIDq31 = PID_Q31_DEFAULTS;
+static tPIDq15 sPIDq15 = PID_Q15_DEFAULTS;
+
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Step functions of the benchmark cases.
+  * @param  k: index of the input sample.
+  * @retval None
+  */
+static void tIMbench_empty(unsigned k)
+{
+	(void)k;
+}
+
+static void tIMbench_statObs(unsigned k)
+{
+	sIMstatObs.fUsAl = afUsAl[k];
+	sIMstatObs.fUsBe = afUsBe[k];
+	sIMstatObs.fIsAl = afIsAl[k];
+	sIMstatObs.fIsBe = afIsBe[k];
+	sIMstatObs.m_calc(&sIMstatObs, &sIMparams);
+}
+
+static void tIMbench_statObsFilt(unsigned k)
+{
+	sIMstatObsFilt.fUsAl = afUsAl[k];
+	sIMstatObsFilt.fUsBe = afUsBe[k];
+	sIMstatObsFilt.fIsAl = afIsAl[k];
+	sIMstatObsFilt.fIsBe = afIsBe[k];
+	sIMstatObsFilt.m_calc(&sIMstatObsFilt, &sIMparams);
+}
+
+static void tIMbench_rotObs(unsigned k)
+{
+	sIMrotObs.fIsAl = afIsAl[k];
+	sIMrotObs.fIsBe = afIsBe[k];
+	sIMrotObs.fWrE = 100.0f;
+	sIMrotObs.m_calc(&sIMrotObs, &sIMparams);
+}
+
+static void tIMbench_rotObsDisc(unsigned k, unsigned i)
+{
+	asIMrotObsDisc[i].fIsAl = afIsAl[k];
+	asIMrotObsDisc[i].fIsBe = afIsBe[k];
+	asIMrotObsDisc[i].fWrE = 100.0f;
+	asIMrotObsDisc[i].m_calc(&asIMrotObsDisc[i], &sIMparams);
+}
+
+static void tIMbench_rotObsExact(unsigned k) { tIMbench_rotObsDisc(k, 0); }
+static void tIMbench_rotObsLut(unsigned k) { tIMbench_rotObsDisc(k, 1); }
+static void tIMbench_rotObsBilin(unsigned k) { tIMbench_rotObsDisc(k, 2); }
+static void tIMbench_rotObsRK2(unsigned k) { tIMbench_rotObsDisc(k, 3); }
+
+static void tIMbench_speedObs(unsigned k)
+{
+	sIMspeedObs.fUsAl = afUsAl[k];
+	sIMspeedObs.fUsBe = afUsBe[k];
+	sIMspeedObs.fIsAl = afIsAl[k];
+	sIMspeedObs.fIsBe = afIsBe[k];
+	sIMspeedObs.m_calc(&sIMspeedObs, &sIMparams);
+}
+
+static void tIMbench_speedObsBound(unsigned k)
+{
+	(void)k;	// the binding points to the buffer updated by DMA
+	sIMspeedObsBound.m_calc(&sIMspeedObsBound, &sIMparams);
+}
+
+static void tIMbench_ekf(unsigned k)
+{
+	sIMekf.fUsAl = afUsAl[k];
+	sIMekf.fUsBe = afUsBe[k];
+	sIMekf.fIsAl = afIsAl[k];
+	sIMekf.fIsBe = afIsBe[k];
+	sIMekf.m_calc(&sIMekf, &sIMparams);
+}
+
+static void tIMbench_fluxObs(unsigned k, tIMfluxObs* ptObs)
+{
+	ptObs->fUsAl = afUsAl[k];
+	ptObs->fUsBe = afUsBe[k];
+	ptObs->fIsAl = afIsAl[k];
+	ptObs->fIsBe = afIsBe[k];
+	ptObs->m_calc(ptObs, &sIMparams);
+}
+
+static void tIMbench_luenObs(unsigned k) { tIMbench_fluxObs(k, &sIMluenObs); }
+static void tIMbench_smObs(unsigned k) { tIMbench_fluxObs(k, &sIMsmObs); }
+
+static void tIMbench_startup(unsigned k)
+{
+	sIMspeedObsStart.fUsAl = afUsAl[k];
+	sIMspeedObsStart.fUsBe = afUsBe[k];
+	sIMspeedObsStart.fIsAl = afIsAl[k];
+	sIMspeedObsStart.fIsBe = afIsBe[k];
+	sIMstartup.m_calc(&sIMstartup, &sIMspeedObsStart, &sIMparams);
+}
+
+static void tIMbench_foc(unsigned k)
+{
+	sIMfoc.fIa = afIsAl[k];
+	sIMfoc.fIb = -0.5f*afIsAl[k] + 0.866025f*afIsBe[k];
+	sIMfoc.m_calc(&sIMfoc, &sIMparams);
+}
+
+static void tIMbench_plant(unsigned k)
+{
+	(void)k;
+	sIMplant.m_calc(&sIMplant, &sIMparams, IM_PLANT_BANK_SIZE);
+}
+
+static void tIMbench_speedObsBlock(unsigned k)
+{
+	tIMblockIn sIn = {afUsAl, afUsBe, afIsAl, afIsBe, 1};
+	tIMblockOut sOut = {afWrE, 0, 0, 1};
+
+	(void)k;
+	tIMspeedObs_calcBlock(&sIMspeedObs, &sIMparams, &sIn, &sOut, IM_BENCH_BLOCK);
+}
+
+static void tIMbench_bank(unsigned k)
+{
+	(void)k;
+	sIMbank.m_calc(&sIMbank, &sIMparams, IM_SPEED_OBS_BANK_SIZE);
+}
+
+static void tIMbench_bankTab(unsigned k)
+{
+	(void)k;
+	tIMspeedObsBank_calcTab(&sIMbank, asIMparamsTab, 2, IM_SPEED_OBS_BANK_SIZE);
+}
+
+static void tIMbench_bankRef(unsigned k)
+{
+	(void)k;
+	tIMspeedObsBank_calcRef(&sIMbank, &sIMparams, IM_SPEED_OBS_BANK_SIZE);
+}
+
+static void tIMbench_bankLoad(unsigned k)
+{
+	(void)k;
+	tIMstate_load(&sIMstateSpeedObsBank, &sIMbank, 1, au8BankState, szBankState);
+}
+
+static void tIMbench_P(unsigned k)
+{
+	sP.fIn = afIsAl[k];
+	sP.m_calc(&sP);
+}
+
+static void tIMbench_PI(unsigned k)
+{
+	sPI.fIn = afIsAl[k];
+	sPI.m_calc(&sPI);
+}
+
+static void tIMbench_PD(unsigned k)
+{
+	sPD.fIn = afIsAl[k];
+	sPD.m_calc(&sPD);
+}
+
+static void tIMbench_PID(unsigned k)
+{
+	sPID.fIn = afIsAl[k];
+	sPID.m_calc(&sPID);
+}
+
+static void tIMbench_PIDbank(unsigned k)
+{
+	(void)k;
+	sPIDbank.m_calc(&sPIDbank, PID_BANK_SIZE);
+}
+
+static void tIMbench_speedObsQ31(unsigned k)
+{
+	sIMspeedObsQ31.qUsAl = aqUsAl31[k];
+	sIMspeedObsQ31.qUsBe = aqUsBe31[k];
+	sIMspeedObsQ31.qIsAl = aqIsAl31[k];
+	sIMspeedObsQ31.qIsBe = aqIsBe31[k];
+	sIMspeedObsQ31.m_calc(&sIMspeedObsQ31, &sIMparamsQ31);
+}
+
+static void tIMbench_speedObsQ15(unsigned k)
+{
+	sIMspeedObsQ15.qUsAl = aqUsAl15[k];
+	sIMspeedObsQ15.qUsBe = aqUsBe15[k];
+	sIMspeedObsQ15.qIsAl = aqIsAl15[k];
+	sIMspeedObsQ15.qIsBe = aqIsBe15[k];
+	sIMspeedObsQ15.m_calc(&sIMspeedObsQ15, &sIMparamsQ15);
+}
+
+static void tIMbench_PIDq31(unsigned k)
+{
+	sPIDq31.qIn = aqIsAl31[k];
+	sPIDq31.m_calc(&sPIDq31);
+}
+
+static void tIMbench_PIDq15(unsigned k)
+{
+	sPIDq15.qIn = aqIsAl15[k];
+	sPIDq15.m_calc(&sPIDq15);
+}
+
+/* benchmark cases table */
+static const tIMbenchCase asCase[] = {
+	{"tIMstatObs_calc",		tIMbench_statObs,	1},
+	{"tIMstatObs_calcFilt",		tIMbench_statObsFilt,	1},
+	{"tIMrotObs_calc",		tIMbench_rotObs,	1},
+	{"tIMrotObs_calcExact",		tIMbench_rotObsExact,	1},
+	{"tIMrotObs_calcLut",		tIMbench_rotObsLut,	1},
+	{"tIMrotObs_calcBilin",		tIMbench_rotObsBilin,	1},
+	{"tIMrotObs_calcRK2",		tIMbench_rotObsRK2,	1},
+	{"tIMspeedObs_calc",		tIMbench_speedObs,	1},
+	{"tIMspeedObs_calcBound",	tIMbench_speedObsBound,	1},
+	{"tIMekf_calc",			tIMbench_ekf,		1},
+	{"tIMfluxObs_calcLuen",		tIMbench_luenObs,	1},
+	{"tIMfluxObs_calcSmo",		tIMbench_smObs,		1},
+	{"tIMstartup_calc",		tIMbench_startup,	1},
+	{"tIMfoc_calc",			tIMbench_foc,		1},
+	{"tIMplantBank_calc",		tIMbench_plant,		IM_PLANT_BANK_SIZE},
+	{"tIMspeedObs_calcBlock",	tIMbench_speedObsBlock,	IM_BENCH_BLOCK},
+	{"tIMspeedObsBank_calc",	tIMbench_bank,		IM_SPEED_OBS_BANK_SIZE},
+	{"tIMspeedObsBank_calcTab",	tIMbench_bankTab,	IM_SPEED_OBS_BANK_SIZE},
+	{"tIMspeedObsBank_calcRef",	tIMbench_bankRef,	IM_SPEED_OBS_BANK_SIZE},
+	{"tIMstate_load(Bank)",		tIMbench_bankLoad,	IM_SPEED_OBS_BANK_SIZE},
+	{"tP_calc",			tIMbench_P,		1},
+	{"tPI_calc",			tIMbench_PI,		1},
+	{"tPD_calc",			tIMbench_PD,		1},
+	{"tPID_calc",			tIMbench_PID,		1},
+	{"tPIDbank_calc",		tIMbench_PIDbank,	PID_BANK_SIZE},
+	{"tIMspeedObsQ31_calc",		tIMbench_speedObsQ31,	1},
+	{"tIMspeedObsQ15_calc",		tIMbench_speedObsQ15,	1},
+	{"tPIDq31_calc",		tIMbench_PIDq31,	1},
+	{"tPIDq15_calc",		tIMbench_PIDq15,	1}
+};
+
+/**
+  * @brief  Initialize the input signals, estimators and controllers under test
+  *	    (motor parameters of the README examples, 50 Hz stator frequency).
+  * @param  None
+  * @retval None
+  */
+static void tIMbench_setup(void)
+{
+	unsigned i;
+
+	for(i = 0; i < IM_BENCH_SIG; i++)
+	{
+		float fAng = 2.0f*IM_PI*(float)i/(float)IM_BENCH_SIG;
+
+		afUsAl[i] = 200.0f*cosf(fAng + 0.3f);
+		afUsBe[i] = 200.0f*sinf(fAng + 0.3f);
+		afIsAl[i] = 3.0f*cosf(fAng);
+		afIsBe[i] = 3.0f*sinf(fAng);
+		aqUsAl31[i] = q31_from_float(afUsAl[i]/400.0f);
+		aqUsBe31[i] = q31_from_float(afUsBe[i]/400.0f);
+		aqIsAl31[i] = q31_from_float(afIsAl[i]/10.0f);
+		aqIsBe31[i] = q31_from_float(afIsBe[i]/10.0f);
+		aqUsAl15[i] = q31_to_q15(aqUsAl31[i]);
+		aqUsBe15[i] = q31_to_q15(aqUsBe31[i]);
+		aqIsAl15[i] = q31_to_q15(aqIsAl31[i]);
+		aqIsBe15[i] = q31_to_q15(aqIsBe31[i]);
+	}
+
+	sIMparams.fDt = 0.0003125f;	// 64 samples of 50 Hz period
+	sIMparams.fNpP = 2.0f;
+	sIMparams.fRr = 4.516f;
+	sIMparams.fRs = 50.0f;
+	sIMparams.fLr = 0.143f;
+	sIMparams.fLs = 0.143f;
+	sIMparams.fLm = 0.14f;
+	sIMparams.fTdf = 4.0f*sIMparams.fDt;
+	sIMparams.m_init(&sIMparams);
+	sIMstatObsFilt.m_calc = tIMstatObs_calcFilt;
+
+	asIMrotObsDisc[0].m_calc = tIMrotObs_calcExact;
+	asIMrotObsDisc[1].m_calc = tIMrotObs_calcLut;
+	asIMrotObsDisc[1].ptLut = &sIMrotLut;
+	tIMrotLut_init(&sIMrotLut, sIMparams.fDt);
+	asIMrotObsDisc[2].m_calc = tIMrotObs_calcBilin;
+	asIMrotObsDisc[3].m_calc = tIMrotObs_calcRK2;
+
+	sPI.fDtSec = sIMparams.fDt;
+	sPI.fKp = 0.1f;
+	sPI.fKi = 10.0f;
+	sPI.fUpOutLim = 600.0f;
+	sPI.fLowOutLim = -600.0f;
+	sPI.m_init(&sPI);
+	sIMspeedObs.sPI = sPI;
+	
+	sIMspeedObsBound.sPI = sPI;
+	sIMspeedObsBound.m_calc = tIMspeedObs_calcBound;
+	sIMspeedObsBound.sBind.pfUsAl = &afUsAl[0];
+	sIMspeedObsBound.sBind.pfUsBe = &afUsBe[0];
+	sIMspeedObsBound.sBind.pfIsAl = &afIsAl[0];
+	sIMspeedObsBound.sBind.pfIsBe = &afIsBe[0];
+	sIMekf.m_init(&sIMekf);
+	sIMluenObs.sPI = sIMsmObs.sPI = sPI;
+	sIMluenObs.m_init(&sIMluenObs, &sIMparams);
+	sIMsmObs.m_init(&sIMsmObs, &sIMparams);
+	sIMspeedObsStart.sPI = sPI;
+	sIMstartup.uMode = IM_STARTUP_CATCH;	// window sums and the test, never
+	sIMstartup.fTolW = -1.0f;		// converged (no forwarding)
+	sIMstartup.m_init(&sIMstartup);
+	sIMfoc.sIMspeedObs.sPI = sPI;
+	sIMfoc.sPId.fKp = sIMfoc.sPIq.fKp = 6.0f;
+	sIMfoc.sPId.fKi = sIMfoc.sPIq.fKi = 840.0f;
+	sIMfoc.sPId.fUpOutLim = sIMfoc.sPIq.fUpOutLim = 300.0f;
+	sIMfoc.sPId.fLowOutLim = sIMfoc.sPIq.fLowOutLim = -300.0f;
+	sIMfoc.sPId.uAwMode = sIMfoc.sPIq.uAwMode = PID_AW_CLAMP;
+	sIMfoc.fUdc = 540.0f;
+	sIMfoc.fIdRef = 3.0f;
+	sIMfoc.m_init(&sIMfoc, &sIMparams);
+	
+	sIMplant.m_rst(&sIMplant);
+	for(i = 0; i < IM_PLANT_BANK_SIZE; i++) sIMplant.aptProfile[i] = &sIMprofile;
+	sIMplant.m_init(&sIMplant, &sIMparams);
+
+	sP.fKp = sPI.fKp;
+	sP.fUpOutLim = sPI.fUpOutLim;
+	sP.fLowOutLim = sPI.fLowOutLim;
+	sPD.fDtSec = sPID.fDtSec = sIMparams.fDt;
+	sPD.fKp = sPID.fKp = sPI.fKp;
+	sPD.fKd = sPID.fKd = 0.0001f;
+	sPID.fKi = sPI.fKi;
+	sPD.fUpOutLim = sPID.fUpOutLim = sPI.fUpOutLim;
+	sPD.fLowOutLim = sPID.fLowOutLim = sPI.fLowOutLim;
+	sPD.m_init(&sPD);
+	sPID.m_init(&sPID);
+	
+	sPIDbank.asCoefs[0] = (tPIDcoefs){.fDtSec = sPID.fDtSec, .fKp = sPID.fKp,
+					  .fKi = sPID.fKi, .fKd = sPID.fKd,
+					  .fUpOutLim = sPID.fUpOutLim,
+					  .fLowOutLim = sPID.fLowOutLim};
+	sPIDbank.m_init(&sPIDbank);
+	for(i = 0; i < PID_BANK_SIZE; i++) sPIDbank.afIn[i] = afIsAl[i % IM_BENCH_SIG];
+
+	for(i = 0; i < IM_SPEED_OBS_BANK_SIZE; i++)
+	{
+		sIMbank.afUsAl[i] = afUsAl[i % IM_BENCH_SIG];
+		sIMbank.afUsBe[i] = afUsBe[i % IM_BENCH_SIG];
+		sIMbank.afIsAl[i] = afIsAl[i % IM_BENCH_SIG];
+		sIMbank.afIsBe[i] = afIsBe[i % IM_BENCH_SIG];
+		sIMbank.afKp[i] = sPI.fKp;
+		sIMbank.afKi[i] = sPI.fKi;
+		sIMbank.afUpOutLim[i] = sPI.fUpOutLim;
+		sIMbank.afLowOutLim[i] = sPI.fLowOutLim;
+		sIMbank.auAwMode[i] = sPI.uAwMode;
+		sIMbank.afKaw[i] = sPI.fKaw;
+		sIMbank.auParams[i] = (2*i)/IM_SPEED_OBS_BANK_SIZE;	// two sets (sorted)
+	}
+	asIMparamsTab[0] = asIMparamsTab[1] = sIMparams;
+	szBankState = tIMstate_save(&sIMstateSpeedObsBank, &sIMbank, 1, au8BankState,
+				    sizeof(au8BankState));
+
+	sIMparamsQ31.fDt = sIMparamsQ15.fDt = sIMparams.fDt;
+	sIMparamsQ31.fNpP = sIMparamsQ15.fNpP = sIMparams.fNpP;
+	sIMparamsQ31.fRr = sIMparamsQ15.fRr = sIMparams.fRr;
+	sIMparamsQ31.fRs = sIMparamsQ15.fRs = sIMparams.fRs;
+	sIMparamsQ31.fLr = sIMparamsQ15.fLr = sIMparams.fLr;
+	sIMparamsQ31.fLs = sIMparamsQ15.fLs = sIMparams.fLs;
+	sIMparamsQ31.fLm = sIMparamsQ15.fLm = sIMparams.fLm;
+	sIMparamsQ31.fIbase = sIMparamsQ15.fIbase = 10.0f;
+	sIMparamsQ31.fUbase = sIMparamsQ15.fUbase = 400.0f;
+	sIMparamsQ31.fWbase = sIMparamsQ15.fWbase = 1000.0f;
+	sIMparamsQ31.fFbase = sIMparamsQ15.fFbase = 2.0f;
+	sIMparamsQ31.m_init(&sIMparamsQ31);
+	sIMparamsQ15.m_init(&sIMparamsQ15);
+
+	sIMspeedObsQ31.sPI.fDtSec = sIMspeedObsQ15.sPI.fDtSec = sIMparams.fDt;
+	sIMspeedObsQ31.sPI.fKp = sIMspeedObsQ15.sPI.fKp = sPI.fKp;
+	sIMspeedObsQ31.sPI.fKi = sIMspeedObsQ15.sPI.fKi = sPI.fKi;
+	sIMspeedObsQ31.sPI.fUpOutLim = sIMspeedObsQ15.sPI.fUpOutLim = sPI.fUpOutLim;
+	sIMspeedObsQ31.sPI.fLowOutLim = sIMspeedObsQ15.sPI.fLowOutLim = sPI.fLowOutLim;
+	sIMspeedObsQ31.m_init(&sIMspeedObsQ31, &sIMparamsQ31);
+	sIMspeedObsQ15.m_init(&sIMspeedObsQ15, &sIMparamsQ15);
+
+	sPIDq31.fDtSec = sPIDq15.fDtSec = sIMparams.fDt;
+	sPIDq31.fKp = sPIDq15.fKp = sPID.fKp;
+	sPIDq31.fKi = sPIDq15.fKi = sPID.fKi;
+	sPIDq31.fKd = sPIDq15.fKd = sPID.fKd;
+	sPIDq31.fUpOutLim = sPIDq15.fUpOutLim = sPID.fUpOutLim;
+	sPIDq31.fLowOutLim = sPIDq15.fLowOutLim = sPID.fLowOutLim;
+	sPIDq31.fInBase = sPIDq15.fInBase = 10.0f;
+	sPIDq31.fOutBase = sPIDq15.fOutBase = 1000.0f;
+	sPIDq31.m_init(&sPIDq31);
+	sPIDq15.m_init(&sPIDq15);
+}
+
+/**
+  * @brief  Measure the min execution time of the batch of IM_BENCH_BATCH calls.
+  * @param  m_step: step function,
+  *	    uRep: count of measured batches,
+  *	    pullSum: pointer to the sum of execution times of all batches.
+  * @retval Min execution time of the batch, ticks.
+  */
+static uint32_t tIMbench_batch(void (*m_step)(unsigned), unsigned uRep,
+			       uint64_t* pullSum)
+{
+	uint32_t uMin = 0xFFFFFFFFu;
+	unsigned r, b, k = 0;
+
+	for(b = 0; b < IM_BENCH_BATCH; b++)	// warm-up (caches, branch predictors)
+		m_step(b & (IM_BENCH_SIG - 1));
+
+	*pullSum = 0;
+	for(r = 0; r < uRep; r++)
+	{
+		uint32_t uT0 = imCycles_now();
+		uint32_t uDt;
+
+		for(b = 0; b < IM_BENCH_BATCH; b++, k++)
+			m_step(k & (IM_BENCH_SIG - 1));
+
+		uDt = imCycles_now() - uT0;
+		*pullSum += uDt;
+		if(uDt < uMin) uMin = uDt;
+	}
+	return uMin;
+}
+
+/**
+  * @brief  Run all benchmark cases.
+  * @param  ptRes: pointer to the results array with type "tIMbenchRes",
+  *	    uMax: size of the results array,
+  *	    uRep: count of measured batches of every case (e.g. 1000).
+  * @retval Count of results.
+  */
+unsigned tIMbench_run(tIMbenchRes* ptRes, unsigned uMax, unsigned uRep)
+{
+	uint64_t ullSum;
+	uint32_t uOverhead;
+	unsigned i, uNum = sizeof(asCase)/sizeof(asCase[0]);
+
+	if(uNum > uMax) uNum = uMax;
+	if(uRep == 0) uRep = 1;
+
+	imCycles_init();
+#ifdef IM_WCET_PROFILE
+	imWcet_init();				// flush-to-zero as in the firmware
+#endif
+	tIMbench_setup();
+
+	// overhead of the measurement loop (counter reading and indirect call), the
+	// same min estimate is subtracted from all statistics (so Mean >= Min)
+	uOverhead = tIMbench_batch(tIMbench_empty, uRep, &ullSum);
+
+	for(i = 0; i < uNum; i++)
+	{
+		float fDiv = (float)IM_BENCH_BATCH*(float)asCase[i].uSteps;
+		uint32_t uMin = tIMbench_batch(asCase[i].m_step, uRep, &ullSum);
+		uint32_t uMean = (uint32_t)(ullSum/uRep);
+
+		ptRes[i].pcName = asCase[i].pcName;
+		ptRes[i].uSteps = asCase[i].uSteps;
+		ptRes[i].uCalls = uRep*IM_BENCH_BATCH;
+		ptRes[i].fMin = (uMin > uOverhead) ? (float)(uMin - uOverhead)/fDiv : 0.0f;
+		ptRes[i].fMean = (uMean > uOverhead) ? (float)(uMean - uOverhead)/fDiv : 0.0f;
+	}
+	return uNum;
+}
+
+/**
+  * @brief  Format the value with two decimals (no float support of printf needed).
+  * @param  pcBuf: pointer to the output buffer (at least 24 chars),
+  *	    fX: non-negative value.
+  * @retval Pointer to the output buffer.
+  */
+static const char* tIMbench_fmt(char* pcBuf, float fX)
+{
+	unsigned long ulX = (unsigned long)(fX*100.0f + 0.5f);
+
+	sprintf(pcBuf, "%lu.%02lu", ulX/100, ulX % 100);
+	return pcBuf;
+}
+
+/**
+  * @brief  Human readable table of the benchmark results.
+  * @param  ptRes: pointer to the results array with type "tIMbenchRes",
+  *	    uNum: count of results,
+  *	    m_put: pointer to the line output function (printf, UART, etc.).
+  * @retval None
+  */
+void tIMbench_print(const tIMbenchRes* ptRes, unsigned uNum, void (*m_put)(const char*))
+{
+	char acLine[128], acMin[24], acMean[24];
+	unsigned i;
+
+	sprintf(acLine, "%-26s %6s %12s %12s  (%s per step)\n", "Function", "Steps",
+		"Min", "Mean", IM_CYCLES_UNIT);
+	m_put(acLine);
+	for(i = 0; i < uNum; i++)
+	{
+		sprintf(acLine, "%-26s %6u %12s %12s\n", ptRes[i].pcName, ptRes[i].uSteps,
+			tIMbench_fmt(acMin, ptRes[i].fMin),
+			tIMbench_fmt(acMean, ptRes[i].fMean));
+		m_put(acLine);
+	}
+}
+
+/**
+  * @brief  Machine readable (JSON) benchmark results with the layout of Google
+  *	    Benchmark output: "real_time" and "cpu_time" are the mean times per step
+  *	    in "time_unit" (IM_CYCLES_UNIT), "min_time" is the min time per step.
+  * @param  ptRes: pointer to the results array with type "tIMbenchRes",
+  *	    uNum: count of results,
+  *	    m_put: pointer to the text output function.
+  * @retval None
+  */
+void tIMbench_json(const tIMbenchRes* ptRes, unsigned uNum, void (*m_put)(const char*))
+{
+	char acLine[256], acMin[24], acMean[24];
+	unsigned i;
+
+	sprintf(acLine, "{\n  \"context\": {\"library\": \"im_estimators\", "
+		"\"simd_lanes\": %u, \"fast_math\": %d},\n  \"benchmarks\": [\n",
+		tIMspeedObsBank_lanes(), IM_FAST_MATH);
+	m_put(acLine);
+	for(i = 0; i < uNum; i++)
+	{
+		sprintf(acLine, "    {\"name\": \"%s\", \"run_type\": \"iteration\", "
+			"\"iterations\": %u, \"steps\": %u, \"real_time\": %s, "
+			"\"cpu_time\": %s, \"min_time\": %s, \"time_unit\": \"%s\"}%s\n",
+			ptRes[i].pcName, ptRes[i].uCalls, ptRes[i].uSteps,
+			tIMbench_fmt(acMean, ptRes[i].fMean), acMean,
+			tIMbench_fmt(acMin, ptRes[i].fMin), IM_CYCLES_UNIT,
+			(i + 1 < uNum) ? "," : "");
+		m_put(acLine);
+	}
+	m_put("  ]\n}\n");
+}
+
+#ifdef IM_BENCH_MAIN
+/* Output file of the JSON results */
+static FILE* pJson;
+
+static void tIMbench_putStdout(const char* pcStr)
+{
+	fputs(pcStr, stdout);
+}
+
+static void tIMbench_putJson(const char* pcStr)
+{
+	fputs(pcStr, pJson);
+}
+
+/**
+  * @brief  Host benchmark program: im_bench [results.json [count of batches]]
+  */
+int main(int argc, char** argv)
+{
+	tIMbenchRes asRes[IM_BENCH_MAX_CASES];
+	unsigned uRep = (argc > 2) ? (unsigned)atoi(argv[2]) : 2000u;
+	unsigned uNum = tIMbench_run(asRes, IM_BENCH_MAX_CASES, uRep);
+
+	tIMbench_print(asRes, uNum, tIMbench_putStdout);
+
+	if(argc > 1)
+	{
+		pJson = fopen(argv[1], "w");
+		if(!pJson) return 1;
+		tIMbench_json(asRes, uNum, tIMbench_putJson);
+		fclose(pJson);
+	}
+	return 0;
+}
+#endif /* IM_BENCH_MAIN */
+
+/*********************************** END OF FILE ***********************************/
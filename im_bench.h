@@ -0,0 +1,97 @@
+/**
+  ***********************************************************************************
+  * @file    im_bench.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the benchmark of the estimators and P/I/D
+  *	     controllers calculation functions:
+  *		+ execution time per step (ns on host, CPU cycles on Cortex-M);
+  *		+ human readable table and machine readable (JSON) results.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_BENCH_H__
+#define __IM_BENCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_cycles.h" // Execution time counter
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Count of calls measured by one pair of counter readings and max count of
+  *	   benchmark cases. Define the IM_BENCH_MAIN at compile time to build the
+  *	   host benchmark program from "im_bench.c" (prints the table and writes
+  *	   the JSON results to the file given by the first argument).
+  */
+#ifndef IM_BENCH_BATCH
+#define IM_BENCH_BATCH		32
+#endif
+
+#define IM_BENCH_MAX_CASES	32
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "Benchmark result" data structure (execution times are in IM_CYCLES_UNIT
+  *	   per step, the overhead of the benchmark loop is subtracted)
+  */
+typedef struct sIMbenchRes
+{
+	const char*	pcName;			// Name of the function
+	unsigned	uSteps;			// Count of steps per call (observers of
+						// the bank, samples of the block)
+	unsigned	uCalls;			// Count of measured calls
+	float		fMin;			// Min time per step
+	float		fMean;			// Mean time per step
+} tIMbenchRes;
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* Run all benchmark cases (returns the count of results) **************************/
+unsigned tIMbench_run(tIMbenchRes*, unsigned, unsigned);
+
+/* Human readable table of the results (line by line output) ***********************/
+void tIMbench_print(const tIMbenchRes*, unsigned, void (*)(const char*));
+
+/* Machine readable results (JSON, Google Benchmark compatible layout) *************/
+void tIMbench_json(const tIMbenchRes*, unsigned, void (*)(const char*));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_BENCH_H__ */
+
+/*********************************** END OF FILE ***********************************/
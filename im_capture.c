@@ -0,0 +1,500 @@
+/**
+  ***********************************************************************************
+  * @file    im_capture.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the binary
+  *	     capture files of the observers datasets (host tools):
+  *		+ open (mmap on POSIX systems, read to memory otherwise) and close;
+  *		+ zero-copy views and converted reads of the samples;
+  *		+ writer and CSV converter program (IM_CAPTURE_MAIN).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include "im_capture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(IM_CAPTURE_NO_MMAP)
+#ifndef IM_CAPTURE_MMAP
+#define IM_CAPTURE_MMAP
+#endif
+#endif
+#ifdef IM_CAPTURE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+
+#define IM_CAP_CHUNK		1024	// Count of samples converted by the writer at once
+#define IM_CAP_READ_CHUNK	(1u << 20) // Size of the first read buffer (not mapped), bytes
+
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+
+#define IM_CAP_ALIGN_UP(x)	(((x) + (IM_CAP_ALIGN - 1)) & ~(uint64_t)(IM_CAP_ALIGN - 1))
+
+/* Private variables --------------------------------------------------------------*/
+
+/* The header size is the part of the file format */
+typedef char tIMcapHdrSizeCheck[(sizeof(tIMcapHdr) == 128) ? 1 : -1];
+
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Release the file memory (mapping or buffer).
+  * @param  ptCap: pointer to user data structure with type "tIMcapture".
+  * @retval None
+  */
+static void tIMcapture_free(tIMcapture* ptCap)
+{
+	if(ptCap->ptHdr == 0) return;
+#ifdef IM_CAPTURE_MMAP
+	if(ptCap->iMapped) munmap((void*)ptCap->ptHdr, ptCap->szSize);
+	else
+#endif
+	free((void*)ptCap->ptHdr);
+	ptCap->ptHdr = 0;
+}
+
+/**
+  * @brief  Open the capture file: the file is memory-mapped (the samples are loaded
+  *	    by the OS on access, so the size of file does not matter; read to memory
+  *	    with IM_CAPTURE_NO_MMAP or without mmap), the header is validated and
+  *	    the IM parameters of the capture are initialized.
+  * @param  ptCap: pointer to user data structure with type "tIMcapture",
+  *	    pcPath: path of the file.
+  * @retval 0 - success, -1 - the file is not opened or it is not valid capture.
+  */
+int tIMcapture_open(tIMcapture* ptCap, const char* pcPath)
+{
+	const tIMcapHdr* ptHdr;
+	uint64_t uElem;
+	unsigned c;
+	
+	ptCap->ptHdr = 0;
+#ifdef IM_CAPTURE_MMAP
+	{
+		struct stat sStat;
+		void* pvMap;
+		int iFd = open(pcPath, O_RDONLY);
+		
+		if(iFd < 0) return -1;
+		if((fstat(iFd, &sStat) != 0) || (sStat.st_size < (off_t)sizeof(tIMcapHdr)))
+		{
+			close(iFd);
+			return -1;
+		}
+		ptCap->szSize = (size_t)sStat.st_size;
+		pvMap = mmap(0, ptCap->szSize, PROT_READ, MAP_SHARED, iFd, 0);
+		close(iFd);
+		if(pvMap == MAP_FAILED) return -1;
+		posix_madvise(pvMap, ptCap->szSize, POSIX_MADV_SEQUENTIAL);
+		ptCap->ptHdr = (const tIMcapHdr*)pvMap;
+		ptCap->iMapped = 1;
+	}
+#else
+	{
+		// read by chunks to the growing buffer (no file size by ftell, the long
+		// offset is 32-bit on some systems)
+		FILE* pFile = fopen(pcPath, "rb");
+		unsigned char* pucBuf = 0;
+		size_t szCap = 0, szRead = 0;
+		
+		if(!pFile) return -1;
+		for(;;)
+		{
+			if(szRead == szCap)
+			{
+				size_t szNew = szCap ? 2*szCap : IM_CAP_READ_CHUNK;
+				unsigned char* pucNew;
+				
+				if((szNew < szCap) || ((pucNew = (unsigned char*)realloc(pucBuf,
+				   szNew)) == 0))
+				{
+					free(pucBuf);
+					fclose(pFile);
+					return -1;
+				}
+				pucBuf = pucNew;
+				szCap = szNew;
+			}
+			szRead += fread(pucBuf + szRead, 1, szCap - szRead, pFile);
+			if(szRead < szCap) break;
+		}
+		if(ferror(pFile) || (szRead < sizeof(tIMcapHdr)))
+		{
+			free(pucBuf);
+			fclose(pFile);
+			return -1;
+		}
+		fclose(pFile);
+		ptCap->szSize = szRead;
+		ptCap->ptHdr = (const tIMcapHdr*)pucBuf;
+		ptCap->iMapped = 0;
+	}
+#endif
+	
+	ptHdr = ptCap->ptHdr;
+	if((ptHdr->uMagic != IM_CAP_MAGIC) || (ptHdr->uVersion != IM_CAP_VERSION) ||
+	   (ptHdr->uHdrSize < sizeof(tIMcapHdr)) || (ptHdr->uType > IM_CAP_I16) ||
+	   (ptHdr->uChannels < 4) || (ptHdr->uChannels > IM_CAP_CHANNELS))
+	{
+		tIMcapture_free(ptCap);
+		return -1;
+	}
+	uElem = (ptHdr->uType == IM_CAP_F32) ? sizeof(float) : sizeof(int16_t);
+	for(c = 0; c < ptHdr->uChannels; c++)
+	{
+		if((ptHdr->auOffset[c] % IM_CAP_ALIGN) || (ptHdr->auOffset[c] > ptCap->szSize) ||
+		   (ptHdr->uNum > (ptCap->szSize - ptHdr->auOffset[c])/uElem))
+		{
+			tIMcapture_free(ptCap);
+			return -1;
+		}
+	}
+	
+	ptCap->uNum = ptHdr->uNum;
+	ptCap->uType = ptHdr->uType;
+	ptCap->uChannels = ptHdr->uChannels;
+	ptCap->sIMparams = (tIMparams)IM_PARAMS_DEFAULTS;
+	ptCap->sIMparams.fDt = ptHdr->fDt;
+	ptCap->sIMparams.fNpP = ptHdr->fNpP;
+	ptCap->sIMparams.fRs = ptHdr->fRs;
+	ptCap->sIMparams.fRr = ptHdr->fRr;
+	ptCap->sIMparams.fLs = ptHdr->fLs;
+	ptCap->sIMparams.fLr = ptHdr->fLr;
+	ptCap->sIMparams.fLm = ptHdr->fLm;
+	ptCap->sIMparams.m_init(&ptCap->sIMparams);
+	return 0;
+}
+
+/**
+  * @brief  Close the capture file (the views of the samples become invalid).
+  * @param  ptCap: pointer to user data structure with type "tIMcapture".
+  * @retval None
+  */
+void tIMcapture_close(tIMcapture* ptCap)
+{
+	tIMcapture_free(ptCap);
+}
+
+/**
+  * @brief  Zero-copy dataset view of the float32 capture samples (the views point
+  *	    to the file mapping, e.g. for "tIMspeedObs_calcBlock" or "tIMsweep").
+  * @param  ptCap: pointer to user data structure with type "tIMcapture",
+  *	    uFirst: index of the first sample,
+  *	    uNum: count of samples,
+  *	    ptData: pointer to the output dataset with type "tIMdataset" (uSkip is
+  *	    not changed, pfWrRef is NULL without the reference speed channel).
+  * @retval 0 - success, -1 - not float32 capture or the samples are out of range.
+  */
+int tIMcapture_view(const tIMcapture* ptCap, uint64_t uFirst, size_t uNum,
+		    tIMdataset* ptData)
+{
+	const uint8_t* puBase = (const uint8_t*)ptCap->ptHdr;
+	const uint64_t* puOfs = ptCap->ptHdr->auOffset;
+	
+	if((ptCap->uType != IM_CAP_F32) || (uFirst > ptCap->uNum) ||
+	   (uNum > ptCap->uNum - uFirst)) return -1;
+	
+	ptData->sIn.pfUsAl = (const float*)(puBase + puOfs[IM_CAP_CH_USAL]) + uFirst;
+	ptData->sIn.pfUsBe = (const float*)(puBase + puOfs[IM_CAP_CH_USBE]) + uFirst;
+	ptData->sIn.pfIsAl = (const float*)(puBase + puOfs[IM_CAP_CH_ISAL]) + uFirst;
+	ptData->sIn.pfIsBe = (const float*)(puBase + puOfs[IM_CAP_CH_ISBE]) + uFirst;
+	ptData->sIn.uStride = 1;
+	ptData->pfWrRef = (ptCap->uChannels > IM_CAP_CH_WRREF) ?
+			  (const float*)(puBase + puOfs[IM_CAP_CH_WRREF]) + uFirst : 0;
+	ptData->uRefStride = 1;
+	ptData->uNum = uNum;
+	return 0;
+}
+
+/**
+  * @brief  Dataset of the capture samples converted to the float32 buffer (any type
+  *	    of capture, e.g. streaming of int16 captures by the cache sized chunks).
+  * @param  ptCap: pointer to user data structure with type "tIMcapture",
+  *	    uFirst: index of the first sample,
+  *	    uNum: count of samples,
+  *	    pfBuf: pointer to the buffer of IM_CAP_CHANNELS*uNum floats (columns),
+  *	    ptData: pointer to the output dataset with type "tIMdataset" (uSkip is
+  *	    not changed, pfWrRef is NULL without the reference speed channel).
+  * @retval Count of read samples (less than uNum at the end of capture).
+  */
+size_t tIMcapture_read(const tIMcapture* ptCap, uint64_t uFirst, size_t uNum,
+		       float* pfBuf, tIMdataset* ptData)
+{
+	const uint8_t* puBase = (const uint8_t*)ptCap->ptHdr;
+	unsigned c;
+	size_t n;
+	
+	if(uFirst >= ptCap->uNum) uNum = 0;
+	else if(uNum > ptCap->uNum - uFirst) uNum = (size_t)(ptCap->uNum - uFirst);
+	
+	for(c = 0; c < ptCap->uChannels; c++)
+	{
+		const uint8_t* puCol = puBase + ptCap->ptHdr->auOffset[c];
+		float* pfCol = pfBuf + (size_t)c*uNum;
+		
+		if(ptCap->uType == IM_CAP_F32)
+		{
+			memcpy(pfCol, (const float*)puCol + uFirst, uNum*sizeof(float));
+		}
+		else
+		{
+			const int16_t* pqCol = (const int16_t*)puCol + uFirst;
+			float fScale = ptCap->ptHdr->afScale[c];
+			
+			for(n = 0; n < uNum; n++) pfCol[n] = (float)pqCol[n]*fScale;
+		}
+	}
+	
+	ptData->sIn.pfUsAl = pfBuf + (size_t)IM_CAP_CH_USAL*uNum;
+	ptData->sIn.pfUsBe = pfBuf + (size_t)IM_CAP_CH_USBE*uNum;
+	ptData->sIn.pfIsAl = pfBuf + (size_t)IM_CAP_CH_ISAL*uNum;
+	ptData->sIn.pfIsBe = pfBuf + (size_t)IM_CAP_CH_ISBE*uNum;
+	ptData->sIn.uStride = 1;
+	ptData->pfWrRef = (ptCap->uChannels > IM_CAP_CH_WRREF) ?
+			  pfBuf + (size_t)IM_CAP_CH_WRREF*uNum : 0;
+	ptData->uRefStride = 1;
+	ptData->uNum = uNum;
+	return uNum;
+}
+
+/**
+  * @brief  Write the capture file of the dataset (the reference speed channel is
+  *	    written when pfWrRef is not NULL).
+  * @param  pcPath: path of the file,
+  *	    ptIMparams: pointer to IM parameters of the capture with type "tIMparams",
+  *	    uType: IM_CAP_F32 or IM_CAP_I16,
+  *	    pfScale: pointer to the scales of the int16 channels (NULL - max abs
+  *	    value of the channel is scaled to 32767),
+  *	    ptData: pointer to the dataset with type "tIMdataset".
+  * @retval 0 - success, -1 - write error.
+  */
+int tIMcapture_write(const char* pcPath, const tIMparams* ptIMparams, unsigned uType,
+		     const float* pfScale, const tIMdataset* ptData)
+{
+	const float* apfCh[IM_CAP_CHANNELS];
+	unsigned auStride[IM_CAP_CHANNELS];
+	uint64_t uOfs, uPos, uElem;
+	tIMcapHdr sHdr;
+	FILE* pFile;
+	unsigned c;
+	size_t n, k;
+	int iRes = 0;
+	
+	apfCh[IM_CAP_CH_USAL] = ptData->sIn.pfUsAl;
+	apfCh[IM_CAP_CH_USBE] = ptData->sIn.pfUsBe;
+	apfCh[IM_CAP_CH_ISAL] = ptData->sIn.pfIsAl;
+	apfCh[IM_CAP_CH_ISBE] = ptData->sIn.pfIsBe;
+	apfCh[IM_CAP_CH_WRREF] = ptData->pfWrRef;
+	for(c = 0; c < IM_CAP_CH_WRREF; c++) auStride[c] = ptData->sIn.uStride;
+	auStride[IM_CAP_CH_WRREF] = ptData->uRefStride;
+	
+	memset(&sHdr, 0, sizeof(sHdr));
+	sHdr.uMagic = IM_CAP_MAGIC;
+	sHdr.uVersion = IM_CAP_VERSION;
+	sHdr.uType = (uint16_t)uType;
+	sHdr.uChannels = ptData->pfWrRef ? IM_CAP_CHANNELS : IM_CAP_CH_WRREF;
+	sHdr.uHdrSize = sizeof(tIMcapHdr);
+	sHdr.uNum = ptData->uNum;
+	sHdr.fDt = ptIMparams->fDt;
+	sHdr.fNpP = ptIMparams->fNpP;
+	sHdr.fRs = ptIMparams->fRs;
+	sHdr.fRr = ptIMparams->fRr;
+	sHdr.fLs = ptIMparams->fLs;
+	sHdr.fLr = ptIMparams->fLr;
+	sHdr.fLm = ptIMparams->fLm;
+	uElem = (uType == IM_CAP_F32) ? sizeof(float) : sizeof(int16_t);
+	uOfs = IM_CAP_ALIGN_UP(sizeof(tIMcapHdr));
+	for(c = 0; c < sHdr.uChannels; c++)
+	{
+		float fMax = 0.0f;
+		
+		sHdr.afScale[c] = 1.0f;
+		if(uType == IM_CAP_I16)
+		{
+			if(pfScale) sHdr.afScale[c] = pfScale[c];
+			else
+			{
+				for(n = 0; n < ptData->uNum; n++)
+				{
+					float fAbs = fabsf(apfCh[c][n*auStride[c]]);
+					
+					if(fAbs > fMax) fMax = fAbs;
+				}
+				if(fMax > 0.0f) sHdr.afScale[c] = fMax/32767.0f;
+			}
+		}
+		sHdr.auOffset[c] = uOfs;
+		uOfs = IM_CAP_ALIGN_UP(uOfs + sHdr.uNum*uElem);
+	}
+	
+	pFile = fopen(pcPath, "wb");
+	if(!pFile) return -1;
+	if(fwrite(&sHdr, sizeof(sHdr), 1, pFile) != 1) iRes = -1;
+	uPos = sizeof(sHdr);
+	for(c = 0; (c < sHdr.uChannels) && (iRes == 0); c++)
+	{
+		union
+		{
+			float	afF32[IM_CAP_CHUNK];
+			int16_t	aqI16[IM_CAP_CHUNK];
+		} uChunk;
+		float f1divScale = 1.0f/sHdr.afScale[c];
+		
+		for(; uPos < sHdr.auOffset[c]; uPos++) if(fputc(0, pFile) == EOF) iRes = -1;
+		for(n = 0; (n < ptData->uNum) && (iRes == 0); n += k)
+		{
+			size_t uLen = ptData->uNum - n;
+			
+			if(uLen > IM_CAP_CHUNK) uLen = IM_CAP_CHUNK;
+			for(k = 0; k < uLen; k++)
+			{
+				float fVal = apfCh[c][(n + k)*auStride[c]];
+				
+				if(uType == IM_CAP_F32) uChunk.afF32[k] = fVal;
+				else
+				{
+					fVal = floorf(fVal*f1divScale + 0.5f);
+					fVal = (fVal > 32767.0f) ? 32767.0f :
+					       (fVal < -32768.0f) ? -32768.0f : fVal;
+					uChunk.aqI16[k] = (int16_t)fVal;
+				}
+			}
+			if(fwrite(&uChunk, (size_t)uElem, uLen, pFile) != uLen) iRes = -1;
+			uPos += uLen*uElem;
+		}
+	}
+	if(fclose(pFile) != 0) iRes = -1;
+	return iRes;
+}
+
+#ifdef IM_CAPTURE_MAIN
+/**
+  * @brief  CSV to capture file converter program: every line of the CSV file is
+  *	    "UsAl,UsBe,IsAl,IsBe[,WrRef]" (lines with less values are skipped, the
+  *	    missing WrRef of the lines with 4 values is 0).
+  *	    Usage: im_capture in.csv out.imc fDt fNpP fRs fRr fLs fLr fLm [i16]
+  * @param  argc: count of arguments,
+  *	    argv: arguments.
+  * @retval 0 - success.
+  */
+int main(int argc, char** argv)
+{
+	tIMparams sIMparams = IM_PARAMS_DEFAULTS;
+	tIMdataset sData;
+	float* pfRec = 0;
+	size_t szNum = 0, szCap = 0;
+	unsigned uCols = 0;
+	char acLine[512];
+	FILE* pFile;
+	int iRes;
+	
+	if(argc < 10)
+	{
+		fprintf(stderr, "usage: %s in.csv out.imc fDt fNpP fRs fRr fLs fLr fLm [i16]\n",
+			argv[0]);
+		return 1;
+	}
+	pFile = fopen(argv[1], "r");
+	if(!pFile) return 1;
+	while(fgets(acLine, sizeof(acLine), pFile))
+	{
+		float afVal[IM_CAP_CHANNELS] = {0.0f};
+		char* pcPos = acLine;
+		unsigned n;
+		
+		for(n = 0; n < IM_CAP_CHANNELS; n++)
+		{
+			char* pcEnd;
+			
+			afVal[n] = strtof(pcPos, &pcEnd);
+			if(pcEnd == pcPos) break;
+			pcPos = pcEnd;
+			while((*pcPos == ',') || (*pcPos == ';') || (*pcPos == ' ') ||
+			      (*pcPos == '\t')) pcPos++;
+		}
+		if(n < IM_CAP_CH_WRREF) continue;	// header or not valid line
+		if(uCols == 0) uCols = n;
+		if(szNum == szCap)
+		{
+			float* pfNew;
+			
+			szCap = szCap ? 2*szCap : 65536;
+			pfNew = (float*)realloc(pfRec, szCap*IM_CAP_CHANNELS*sizeof(float));
+			if(!pfNew) { free(pfRec); fclose(pFile); return 1; }
+			pfRec = pfNew;
+		}
+		memcpy(&pfRec[szNum*IM_CAP_CHANNELS], afVal, IM_CAP_CHANNELS*sizeof(float));
+		szNum++;
+	}
+	fclose(pFile);
+	if(szNum == 0)					// no columns without samples
+	{
+		fprintf(stderr, "%s: no samples\n", argv[1]);
+		return 1;
+	}
+	
+	sIMparams.fDt = strtof(argv[3], 0);
+	sIMparams.fNpP = strtof(argv[4], 0);
+	sIMparams.fRs = strtof(argv[5], 0);
+	sIMparams.fRr = strtof(argv[6], 0);
+	sIMparams.fLs = strtof(argv[7], 0);
+	sIMparams.fLr = strtof(argv[8], 0);
+	sIMparams.fLm = strtof(argv[9], 0);
+	
+	sData.sIn.pfUsAl = pfRec + IM_CAP_CH_USAL;		// interleaved records
+	sData.sIn.pfUsBe = pfRec + IM_CAP_CH_USBE;
+	sData.sIn.pfIsAl = pfRec + IM_CAP_CH_ISAL;
+	sData.sIn.pfIsBe = pfRec + IM_CAP_CH_ISBE;
+	sData.sIn.uStride = IM_CAP_CHANNELS;
+	sData.pfWrRef = (uCols > IM_CAP_CH_WRREF) ? pfRec + IM_CAP_CH_WRREF : 0;
+	sData.uRefStride = IM_CAP_CHANNELS;
+	sData.uNum = szNum;
+	sData.uSkip = 0;
+	
+	iRes = tIMcapture_write(argv[2], &sIMparams, ((argc > 10) && !strcmp(argv[10], "i16")) ?
+				IM_CAP_I16 : IM_CAP_F32, 0, &sData);
+	free(pfRec);
+	printf("%llu samples, %u channels\n", (unsigned long long)sData.uNum,
+	       sData.pfWrRef ? 5u : 4u);
+	return iRes ? 1 : 0;
+}
+#endif /* IM_CAPTURE_MAIN */
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,150 @@
+/**
+  ***********************************************************************************
+  * @file    im_capture.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the binary capture files of the observers
+  *	     datasets (host tools):
+  *		+ columnar float32 or int16 (per-channel scale) samples with the fixed
+  *		  header carrying the IM parameters and fDt;
+  *		+ memory-mapped reader with zero-copy views for the block API;
+  *		+ writer and CSV converter program.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_CAPTURE_H__
+#define __IM_CAPTURE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_sweep.h" // Speed observer parameter sweep (dataset views)
+#include <stdint.h>
+#include <stddef.h>
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Capture file format: the header "tIMcapHdr" (little-endian) is followed by
+  *	   the channels columns, every column starts at IM_CAP_ALIGN bytes aligned
+  *	   offset. Channels: UsAl, UsBe (Volts), IsAl, IsBe (A) and the optional
+  *	   reference rotor mechanical speed (Rad/Sec). The int16 sample value is
+  *	   q*afScale[channel]. Define the IM_CAPTURE_MAIN at compile time to build
+  *	   the CSV converter program from "im_capture.c".
+  */
+#define IM_CAP_MAGIC		0x50434D49u	// "IMCP"
+#define IM_CAP_VERSION		1
+#define IM_CAP_ALIGN		64		// Alignment of the columns, bytes
+
+#define IM_CAP_F32		0		// float32 samples
+#define IM_CAP_I16		1		// int16 samples with scale
+
+#define IM_CAP_CH_USAL		0		// Channels indexes
+#define IM_CAP_CH_USBE		1
+#define IM_CAP_CH_ISAL		2
+#define IM_CAP_CH_ISBE		3
+#define IM_CAP_CH_WRREF		4
+#define IM_CAP_CHANNELS		5		// Max count of channels
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "Capture file header" data structure (128 bytes, stored as is)
+  */
+typedef struct sIMcapHdr
+{
+	uint32_t	uMagic;				// IM_CAP_MAGIC
+	uint16_t	uVersion;			// IM_CAP_VERSION
+	uint16_t	uType;				// IM_CAP_F32 or IM_CAP_I16
+	uint32_t	uChannels;			// Count of channels (4 or 5)
+	uint32_t	uHdrSize;			// Size of header, bytes
+	uint64_t	uNum;				// Count of samples per channel
+	float		fDt;				// Discretization time, Sec
+	float		fNpP;				// IM parameters (same as the
+	float		fRs;				// inputs of "tIMparams")
+	float		fRr;
+	float		fLs;
+	float		fLr;
+	float		fLm;
+	float		afScale[IM_CAP_CHANNELS];	// Scale of int16 samples
+	uint64_t	auOffset[IM_CAP_CHANNELS];	// Offset of columns, bytes
+	uint8_t		auReserved[16];			// Zeros
+} tIMcapHdr;
+
+/**
+  * @brief "Opened capture file" data structure
+  */
+typedef struct sIMcapture
+{
+// Outputs:
+	tIMparams	sIMparams;		// IM parameters of the capture (initialized)
+	uint64_t	uNum;			// Count of samples per channel
+	unsigned	uType;			// IM_CAP_F32 or IM_CAP_I16
+	unsigned	uChannels;		// Count of channels
+// Internal variables:
+	const tIMcapHdr* ptHdr;			// Header (start of the file mapping)
+	size_t		szSize;			// Size of the file, bytes
+	int		iMapped;		// 1 - mapped (mmap), 0 - read to memory
+} tIMcapture;
+
+/* Exported macro -----------------------------------------------------------------*/
+
+/**
+  * @brief Define the IM_CAPTURE_NO_MMAP at compile time to read the capture files to
+  *	   memory instead of the mapping (IM_CAPTURE_MMAP, default on the POSIX
+  *	   systems, can be also defined by the user on others with mmap).
+  */
+
+/* Exported functions -------------------------------------------------------------*/
+
+/* Open the capture file (memory-mapped) *******************************************/
+int tIMcapture_open(tIMcapture*, const char*);
+
+/* Close the capture file **********************************************************/
+void tIMcapture_close(tIMcapture*);
+
+/* Zero-copy dataset view of the float32 capture samples ***************************/
+int tIMcapture_view(const tIMcapture*, uint64_t, size_t, tIMdataset*);
+
+/* Dataset of the capture samples converted to float32 buffer **********************/
+size_t tIMcapture_read(const tIMcapture*, uint64_t, size_t, float*, tIMdataset*);
+
+/* Write the capture file **********************************************************/
+int tIMcapture_write(const char*, const tIMparams*, unsigned, const float*,
+		     const tIMdataset*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_CAPTURE_H__ */
+
+/*********************************** END OF FILE ***********************************/
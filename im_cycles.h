@@ -0,0 +1,120 @@
+/**
+  ***********************************************************************************
+  * @file    im_cycles.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the inline functions of the execution time counter
+  *	     used by the benchmark and instrumentation of estimators:
+  *		+ Cortex-M3/M4/M7/M33/M55/M85 - DWT cycle counter (CPU cycles);
+  *		+ host (POSIX) - monotonic clock (nanoseconds).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_CYCLES_H__
+#define __IM_CYCLES_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Source of the execution time counter (selected at compile time):
+  *	   IM_CYCLES_DWT  - DWT cycle counter of ARMv7-M/ARMv8-M Mainline cores,
+  *			    the tick is one CPU cycle;
+  *	   IM_CYCLES_HOST - POSIX "clock_gettime(CLOCK_MONOTONIC)", the tick is
+  *			    one nanosecond (when the POSIX declarations are not
+  *			    enabled, e.g. by _POSIX_C_SOURCE >= 199309L, the
+  *			    standard C "clock()" of lower resolution is used).
+  *	   The counter is 32-bit and wraps around, the differences of two ticks
+  *	   (uint32_t subtraction) are valid for intervals < 2^32 ticks.
+  */
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+    defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+#define IM_CYCLES_DWT
+#define IM_CYCLES_UNIT		"cycles"
+
+#define IM_DEMCR		(*(volatile uint32_t*)0xE000EDFCu)	// Debug Exception and
+									// Monitor Control
+#define IM_DWT_CTRL		(*(volatile uint32_t*)0xE0001000u)	// DWT Control
+#define IM_DWT_CYCCNT		(*(volatile uint32_t*)0xE0001004u)	// DWT Cycle Counter
+#define IM_DWT_LAR		(*(volatile uint32_t*)0xE0001FB0u)	// DWT Lock Access
+									// (Cortex-M7)
+#else
+#include <time.h>
+#define IM_CYCLES_HOST
+#define IM_CYCLES_UNIT		"ns"
+#endif
+
+/* Exported functions -------------------------------------------------------------*/
+
+/**
+  * @brief  Enable the execution time counter (call once before the measurements).
+  * @param  None
+  * @retval None
+  */
+static inline void imCycles_init(void)
+{
+#if defined(IM_CYCLES_DWT)
+	IM_DEMCR |= (1u << 24);			// TRCENA: enable DWT and ITM
+	IM_DWT_LAR = 0xC5ACCE55u;		// unlock DWT registers (Cortex-M7)
+	IM_DWT_CYCCNT = 0;
+	IM_DWT_CTRL |= 1u;			// CYCCNTENA: enable cycle counter
+#endif
+}
+
+/**
+  * @brief  Current value of the execution time counter.
+  * @param  None
+  * @retval Ticks (IM_CYCLES_UNIT).
+  */
+static inline uint32_t imCycles_now(void)
+{
+#if defined(IM_CYCLES_DWT)
+	return IM_DWT_CYCCNT;
+#elif defined(CLOCK_MONOTONIC)
+	struct timespec sTs;
+
+	clock_gettime(CLOCK_MONOTONIC, &sTs);
+	return (uint32_t)((uint64_t)sTs.tv_sec*1000000000u + (uint64_t)sTs.tv_nsec);
+#else
+	return (uint32_t)((uint64_t)clock()*(1000000000u/CLOCKS_PER_SEC));
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_CYCLES_H__ */
+
+/*********************************** END OF FILE ***********************************/
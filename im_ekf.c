@@ -0,0 +1,231 @@
+/**
+  ***********************************************************************************
+  * @file    im_ekf.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the extended
+  *	     Kalman filter rotor speed and flux observer of the induction motor:
+  *		+ initialization of the state and covariance;
+  *		+ prediction and stator current measurement update (unrolled).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_ekf.h"
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  IM EKF rotor speed and flux observer initialization function: the state
+  *	    is taken from the inputs fIsAl, fIsBe and the outputs fFrAl, fFrBe, fWrE
+  *	    (zeros by default), the covariance is set to the initial variances.
+  * @param  ptIMekf: pointer to user data structure with type "tIMekf".
+  * @retval None
+  */
+void tIMekf_init(tIMekf* ptIMekf)
+{
+	unsigned i;
+	
+	ptIMekf->fXIsAl = ptIMekf->fIsAl;
+	ptIMekf->fXIsBe = ptIMekf->fIsBe;
+	for(i = 0; i < 15; i++) ptIMekf->afP[i] = 0.0f;
+	ptIMekf->afP[0] = ptIMekf->afP[5] = ptIMekf->fR;		// P00, P11
+	ptIMekf->afP[9] = ptIMekf->afP[12] = ptIMekf->fP0f;	// P22, P33
+	ptIMekf->afP[14] = ptIMekf->fP0w;			// P44
+}
+
+/**
+  * @brief  IM EKF rotor speed and flux observer calculation function. The Jacobian
+  *	    F = I + fDt*df/dx has the 2x2 blocks of the form a*I + b*J and the unit
+  *	    speed row, only its 16 not constant elements are used: P = F*P*F' + Q
+  *	    is ~140 multiplications (instead of 250 of the full products), the gain and
+  *	    the update use the 2x2 innovation covariance inverse.
+  * @param  ptIMekf: pointer to user data structure with type "tIMekf",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+void tIMekf_calc(tIMekf* ptIMekf, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	const float fDt = ptIMparams->fDt;
+	const float fKr = ptIMparams->fLm/ptIMparams->fLr;
+	const float f1divSig = 1.0f/ptIMparams->fSigLs;
+	const float fA = ptIMparams->f1divTr;
+	const float fB = ptIMparams->fLmDivTr;
+	const float fC1 = (ptIMparams->fRs + fKr*fB)*f1divSig;
+	const float fC2 = fKr*fA*f1divSig;
+	const float fC3 = fKr*f1divSig;
+	float fIa = ptIMekf->fXIsAl, fIb = ptIMekf->fXIsBe;
+	float fFa = ptIMekf->fFrAl, fFb = ptIMekf->fFrBe;
+	float fW = ptIMekf->fWrE;
+	// Jacobian elements at the previous estimate
+	float fFii = 1.0f - fDt*fC1;
+	float fFif = fDt*fC2;
+	float fFifW = fDt*fC3*fW;
+	float fFiw0 = fDt*fC3*fFb;
+	float fFiw1 = -fDt*fC3*fFa;
+	float fFfi = fDt*fB;
+	float fFff = 1.0f - fDt*fA;
+	float fFffW = fDt*fW;
+	float fFfw0 = -fDt*fFb;
+	float fFfw1 = fDt*fFa;
+	const float fQi = ptIMekf->fQi, fQf = ptIMekf->fQf, fQw = ptIMekf->fQw;
+	float fE0, fE1, fS00, fS01, fS11, f1divDet;
+	float p00 = ptIMekf->afP[0];
+	float p01 = ptIMekf->afP[1];
+	float p02 = ptIMekf->afP[2];
+	float p03 = ptIMekf->afP[3];
+	float p04 = ptIMekf->afP[4];
+	float p11 = ptIMekf->afP[5];
+	float p12 = ptIMekf->afP[6];
+	float p13 = ptIMekf->afP[7];
+	float p14 = ptIMekf->afP[8];
+	float p22 = ptIMekf->afP[9];
+	float p23 = ptIMekf->afP[10];
+	float p24 = ptIMekf->afP[11];
+	float p33 = ptIMekf->afP[12];
+	float p34 = ptIMekf->afP[13];
+	float p44 = ptIMekf->afP[14];
+	
+	// State prediction
+	ptIMekf->fXIsAl = fFii*fIa + fFif*fFa + fFifW*fFb + fDt*f1divSig*ptIMekf->fUsAl;
+	ptIMekf->fXIsBe = fFii*fIb + fFif*fFb - fFifW*fFa + fDt*f1divSig*ptIMekf->fUsBe;
+	ptIMekf->fFrAl = fFff*fFa - fFffW*fFb + fFfi*fIa;
+	ptIMekf->fFrBe = fFff*fFb + fFffW*fFa + fFfi*fIb;
+	
+	// Covariance prediction P = F*P*F' + Q (M = F*P, the speed row of F is unit)
+	{
+		float m00 = fFii*p00 + fFif*p02 + fFifW*p03 + fFiw0*p04;
+		float m01 = fFii*p01 + fFif*p12 + fFifW*p13 + fFiw0*p14;
+		float m02 = fFii*p02 + fFif*p22 + fFifW*p23 + fFiw0*p24;
+		float m03 = fFii*p03 + fFif*p23 + fFifW*p33 + fFiw0*p34;
+		float m04 = fFii*p04 + fFif*p24 + fFifW*p34 + fFiw0*p44;
+		float m10 = fFii*p01 - fFifW*p02 + fFif*p03 + fFiw1*p04;
+		float m11 = fFii*p11 - fFifW*p12 + fFif*p13 + fFiw1*p14;
+		float m12 = fFii*p12 - fFifW*p22 + fFif*p23 + fFiw1*p24;
+		float m13 = fFii*p13 - fFifW*p23 + fFif*p33 + fFiw1*p34;
+		float m14 = fFii*p14 - fFifW*p24 + fFif*p34 + fFiw1*p44;
+		float m20 = fFfi*p00 + fFff*p02 - fFffW*p03 + fFfw0*p04;
+		float m21 = fFfi*p01 + fFff*p12 - fFffW*p13 + fFfw0*p14;
+		float m22 = fFfi*p02 + fFff*p22 - fFffW*p23 + fFfw0*p24;
+		float m23 = fFfi*p03 + fFff*p23 - fFffW*p33 + fFfw0*p34;
+		float m24 = fFfi*p04 + fFff*p24 - fFffW*p34 + fFfw0*p44;
+		float m31 = fFfi*p11 + fFffW*p12 + fFff*p13 + fFfw1*p14;
+		float m32 = fFfi*p12 + fFffW*p22 + fFff*p23 + fFfw1*p24;
+		float m33 = fFfi*p13 + fFffW*p23 + fFff*p33 + fFfw1*p34;
+		float m34 = fFfi*p14 + fFffW*p24 + fFff*p34 + fFfw1*p44;
+		
+		p00 = fFii*m00 + fFif*m02 + fFifW*m03 + fFiw0*m04 + fQi;
+		p01 = fFii*m01 - fFifW*m02 + fFif*m03 + fFiw1*m04;
+		p02 = fFfi*m00 + fFff*m02 - fFffW*m03 + fFfw0*m04;
+		p03 = fFfi*m01 + fFffW*m02 + fFff*m03 + fFfw1*m04;
+		p04 = m04;
+		p11 = fFii*m11 - fFifW*m12 + fFif*m13 + fFiw1*m14 + fQi;
+		p12 = fFfi*m10 + fFff*m12 - fFffW*m13 + fFfw0*m14;
+		p13 = fFfi*m11 + fFffW*m12 + fFff*m13 + fFfw1*m14;
+		p14 = m14;
+		p22 = fFfi*m20 + fFff*m22 - fFffW*m23 + fFfw0*m24 + fQf;
+		p23 = fFfi*m21 + fFffW*m22 + fFff*m23 + fFfw1*m24;
+		p24 = m24;
+		p33 = fFfi*m31 + fFffW*m32 + fFff*m33 + fFfw1*m34 + fQf;
+		p34 = m34;
+		p44 = p44 + fQw;
+	}
+	
+	// Measurement update (H = [I 0])
+	fE0 = ptIMekf->fIsAl - ptIMekf->fXIsAl;
+	fE1 = ptIMekf->fIsBe - ptIMekf->fXIsBe;
+	fS00 = p00 + ptIMekf->fR;
+	fS01 = p01;
+	fS11 = p11 + ptIMekf->fR;
+	f1divDet = 1.0f/(fS00*fS11 - fS01*fS01);
+	{
+		float fK00 = (p00*fS11 - p01*fS01)*f1divDet;
+		float fK01 = (p01*fS00 - p00*fS01)*f1divDet;
+		float fK10 = (p01*fS11 - p11*fS01)*f1divDet;
+		float fK11 = (p11*fS00 - p01*fS01)*f1divDet;
+		float fK20 = (p02*fS11 - p12*fS01)*f1divDet;
+		float fK21 = (p12*fS00 - p02*fS01)*f1divDet;
+		float fK30 = (p03*fS11 - p13*fS01)*f1divDet;
+		float fK31 = (p13*fS00 - p03*fS01)*f1divDet;
+		float fK40 = (p04*fS11 - p14*fS01)*f1divDet;
+		float fK41 = (p14*fS00 - p04*fS01)*f1divDet;
+		float fH00 = p00, fH10 = p01;
+		float fH01 = p01, fH11 = p11;
+		float fH02 = p02, fH12 = p12;
+		float fH03 = p03, fH13 = p13;
+		float fH04 = p04, fH14 = p14;
+		
+		ptIMekf->fXIsAl += fK00*fE0 + fK01*fE1;
+		ptIMekf->fXIsBe += fK10*fE0 + fK11*fE1;
+		ptIMekf->fFrAl += fK20*fE0 + fK21*fE1;
+		ptIMekf->fFrBe += fK30*fE0 + fK31*fE1;
+		ptIMekf->fWrE += fK40*fE0 + fK41*fE1;
+		
+		p00 -= fK00*fH00 + fK01*fH10;
+		p01 -= fK00*fH01 + fK01*fH11;
+		p02 -= fK00*fH02 + fK01*fH12;
+		p03 -= fK00*fH03 + fK01*fH13;
+		p04 -= fK00*fH04 + fK01*fH14;
+		p11 -= fK10*fH01 + fK11*fH11;
+		p12 -= fK10*fH02 + fK11*fH12;
+		p13 -= fK10*fH03 + fK11*fH13;
+		p14 -= fK10*fH04 + fK11*fH14;
+		p22 -= fK20*fH02 + fK21*fH12;
+		p23 -= fK20*fH03 + fK21*fH13;
+		p24 -= fK20*fH04 + fK21*fH14;
+		p33 -= fK30*fH03 + fK31*fH13;
+		p34 -= fK30*fH04 + fK31*fH14;
+		p44 -= fK40*fH04 + fK41*fH14;
+	}
+	ptIMekf->afP[0] = p00;
+	ptIMekf->afP[1] = p01;
+	ptIMekf->afP[2] = p02;
+	ptIMekf->afP[3] = p03;
+	ptIMekf->afP[4] = p04;
+	ptIMekf->afP[5] = p11;
+	ptIMekf->afP[6] = p12;
+	ptIMekf->afP[7] = p13;
+	ptIMekf->afP[8] = p14;
+	ptIMekf->afP[9] = p22;
+	ptIMekf->afP[10] = p23;
+	ptIMekf->afP[11] = p24;
+	ptIMekf->afP[12] = p33;
+	ptIMekf->afP[13] = p34;
+	ptIMekf->afP[14] = p44;
+	
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+	imPolarf(ptIMekf->fFrBe, ptIMekf->fFrAl, &ptIMekf->fFrAng, &ptIMekf->fFrMagn);
+#endif
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,137 @@
+/**
+  ***********************************************************************************
+  * @file    im_ekf.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the extended Kalman filter (EKF) rotor
+  *	     speed and flux observer of the induction motor:
+  *		+ 5 states (stator current, rotor flux, rotor speed), stator current
+  *		  measurement;
+  *		+ fixed size unrolled kernels exploiting the Jacobian sparsity and the
+  *		  covariance symmetry (15 stored elements), no dynamic allocation.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_EKF_H__
+#define __IM_EKF_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators.h" // Induction Motor estimators library
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "IM EKF rotor speed & flux observer Module" data structure. The model
+  *	   (stationary frame, forward Euler with fDt, the speed is a random walk):
+  *		dFr/dt = fLmDivTr*Is - f1divTr*Fr + j*fWrE*Fr,
+  *		fSigLs*dIs/dt = Us - fRs*Is - (fLm/fLr)*dFr/dt,
+  *	   the measurement is the stator current. The covariance matrix P is
+  *	   stored as the upper triangle by rows (P00, P01 ... P04, P11 ... P44).
+  */
+typedef struct sIMekf
+{
+// Inputs:
+	float		fUsAl;			// Stator voltage Alpha, Volts
+	float		fUsBe;			// Stator voltage Beta, Volts
+	float		fIsAl;			// Stator current Alpha, A
+	float		fIsBe;			// Stator current Beta, A
+	float		fQi;			// Process noise variance of the stator
+						// current per step, A^2
+	float		fQf;			// Process noise variance of the rotor
+						// flux per step, Wb^2
+	float		fQw;			// Process noise variance of the rotor
+						// speed per step, (Rad/Sec)^2
+	float		fR;			// Measurement noise variance of the
+						// stator current, A^2
+	float		fP0f;			// Initial variance of the rotor flux, Wb^2
+	float		fP0w;			// Initial variance of the rotor speed,
+						// (Rad/Sec)^2
+// Internal variables:
+	float		fXIsAl;			// Estimated stator current Alpha, A
+	float		fXIsBe;			// Estimated stator current Beta, A
+	float		afP[15];		// Covariance matrix (upper triangle)
+// Outputs:
+	float		fFrAl;			// Rotor flux Alpha, Wb
+	float		fFrBe;			// Rotor flux Beta, Wb
+	float		fWrE;			// Rotor electrical speed, Rad/Sec
+	float		fFrAng;			// Rotor flux angle, Rad
+	float		fFrMagn;		// Rotor flux magnitude, Wb
+// Functions:
+	void	(*m_init)(struct sIMekf*);	// Pointer to initialization function
+	void	(*m_calc)(struct sIMekf*,	// Pointer to estimator function
+			  const tIMparams* IM_RESTRICT);
+} tIMekf;
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Initialization constant with defaults for "tIMekf" user variables (the
+  *	   noise variances are the starting point of the tuning, m_init must be
+  *	   called before the first step)
+  */
+#define IM_EKF_DEFAULTS {			\
+	.fUsAl		= 0.0f,			\
+	.fUsBe		= 0.0f,			\
+	.fIsAl		= 0.0f,			\
+	.fIsBe		= 0.0f,			\
+	.fQi		= 1.0e-4f,		\
+	.fQf		= 1.0e-8f,		\
+	.fQw		= 1.0e-1f,		\
+	.fR		= 1.0e-2f,		\
+	.fP0f		= 1.0e-2f,		\
+	.fP0w		= 1.0e+4f,		\
+	.fFrAl		= 0.0f,			\
+	.fFrBe		= 0.0f,			\
+	.fWrE		= 0.0f,			\
+	.fFrAng		= 0.0f,			\
+	.fFrMagn	= 0.0f,			\
+	.m_init		= tIMekf_init,		\
+	.m_calc		= tIMekf_calc		\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* IM EKF rotor speed and flux observer initialization function prototype **********/
+void tIMekf_init(tIMekf*);
+
+/* IM EKF rotor speed and flux observer function prototype *************************/
+void tIMekf_calc(tIMekf*, const tIMparams* IM_RESTRICT);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_EKF_H__ */
+
+/*********************************** END OF FILE ***********************************/
@@ -46,8 +46,39 @@
 /* Private function prototypes ----------------------------------------------------*/
 /* Private functions --------------------------------------------------------------*/
 
+#ifdef IM_SPEED_OBS_TRACE
 /**
-  * @brief  Initialize the induction motor parameters.
+  * @brief  Trace of the speed observer step: execution time statistics and the
+  *	    snapshot of internal signals.
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    uT0: timestamp of the step start, ticks.
+  * @retval None
+  */
+static void tIMspeedObs_trace(tIMspeedObs* ptIMspeedObs, uint32_t uT0)
+{
+	tIMtrace* ptTrace = ptIMspeedObs->ptTrace;
+	uint32_t uExec = imCycles_now() - uT0;
+	
+	tIMtrace_time(ptTrace, uExec);
+	
+	if(tIMtrace_snapTime(ptTrace))
+	{
+		tIMtraceSnap sSnap;
+		
+		sSnap.uTime = uT0;
+		sSnap.uExec = uExec;
+		sSnap.fPIin = ptIMspeedObs->sPI.fIn;
+		sSnap.fResAl = ptIMspeedObs->sIMstatObs.fEsAl - ptIMspeedObs->sIMrotObs.fErAl;
+		sSnap.fResBe = ptIMspeedObs->sIMstatObs.fEsBe - ptIMspeedObs->sIMrotObs.fErBe;
+		sSnap.fWrE = ptIMspeedObs->fWrE;
+		tIMtrace_push(ptTrace, &sSnap);
+	}
+}
+#endif
+
+/**
+  * @brief  Initialize the induction motor parameters and calculate the per-step
+  *	    coefficients of estimators (so the estimators don't use divisions).
   * @param  ptIMparams: pointer to user data structure with type "tIMparams".               
   * @retval None
   */
@@ -57,6 +88,85 @@ void tIMparams_init(tIMparams* ptIMparams)
 	ptIMparams->f1divKr = ptIMparams->fLr/ptIMparams->fLm;
 	ptIMparams->fSigLs = (1.0f - ptIMparams->fLm*ptIMparams->fLm/
 			     (ptIMparams->fLs*ptIMparams->fLr)) * ptIMparams->fLs;
+	
+	ptIMparams->f1divDt = 1.0f/ptIMparams->fDt;
+	ptIMparams->fHalfDt = 0.5f*ptIMparams->fDt;
+	ptIMparams->fKrRs = ptIMparams->fRs*ptIMparams->f1divKr;
+	ptIMparams->fKrSigLsDivDt = ptIMparams->fSigLs*ptIMparams->f1divDt*
+				    ptIMparams->f1divKr;
+	ptIMparams->fLmDivTr = ptIMparams->fLm*ptIMparams->f1divTr;
+	ptIMparams->fExpm1Dt = expm1f(-ptIMparams->fDt*ptIMparams->f1divTr);
+	ptIMparams->fDfK = ptIMparams->fTdf/(ptIMparams->fTdf + ptIMparams->fDt);
+	ptIMparams->fKrSigLsDivTf = ptIMparams->fKrSigLsDivDt*ptIMparams->fDt/
+				    (ptIMparams->fTdf + ptIMparams->fDt);
+}
+
+/**
+  * @brief  Update the resistances of the induction motor parameters, only the
+  *	    dependent per-step coefficients are recalculated (same values as after
+  *	    "tIMparams_init").
+  * @param  ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    fRs: stator resistance, Ohm,
+  *	    fRr: rotor resistance, Ohm.
+  * @retval None
+  */
+void tIMparams_updR(tIMparams* ptIMparams, float fRs, float fRr)
+{
+	ptIMparams->fRs = fRs;
+	ptIMparams->fRr = fRr;
+	ptIMparams->f1divTr = fRr/ptIMparams->fLr;
+	ptIMparams->fKrRs = fRs*ptIMparams->f1divKr;
+	ptIMparams->fLmDivTr = ptIMparams->fLm*ptIMparams->f1divTr;
+	ptIMparams->fExpm1Dt = expm1f(-ptIMparams->fDt*ptIMparams->f1divTr);
+}
+
+/**
+  * @brief  Initialize the double-buffered IM parameters: both sets are initialized
+  *	    by the copy of user IM parameters, the set [0] is active.
+  * @param  ptIMparamsDb: pointer to user data structure with type "tIMparamsDb",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+void tIMparamsDb_init(tIMparamsDb* ptIMparamsDb, const tIMparams* ptIMparams)
+{
+	ptIMparamsDb->asBuf[0] = *ptIMparams;
+	ptIMparamsDb->asBuf[0].m_init(&ptIMparamsDb->asBuf[0]);
+	ptIMparamsDb->asBuf[1] = ptIMparamsDb->asBuf[0];
+	ptIMparamsDb->ptUsed = &ptIMparamsDb->asBuf[0];
+	IM_STORE_REL(ptIMparamsDb->ptActive, &ptIMparamsDb->asBuf[0]);
+}
+
+/**
+  * @brief  Get the back IM parameters set for the update (background task, single
+  *	    writer): the back set is refreshed by the copy of the active one.
+  * @param  ptIMparamsDb: pointer to user data structure with type "tIMparamsDb".
+  * @retval Pointer to the back IM parameters set, NULL when the previously
+  *	    published set is not taken by the reader yet (retry later).
+  */
+tIMparams* tIMparamsDb_back(tIMparamsDb* ptIMparamsDb)
+{
+	tIMparams* ptActive = ptIMparamsDb->ptActive;
+	tIMparams* ptBack = (ptActive == &ptIMparamsDb->asBuf[0]) ?
+			    &ptIMparamsDb->asBuf[1] : &ptIMparamsDb->asBuf[0];
+	
+	if(IM_LOAD_ACQ(ptIMparamsDb->ptUsed) != ptActive) return 0;
+	
+	*ptBack = *ptActive;
+	return ptBack;
+}
+
+/**
+  * @brief  Publish the back IM parameters set got by "tIMparamsDb_back" (the reader
+  *	    uses it from the next "tIMparamsDb_active" call).
+  * @param  ptIMparamsDb: pointer to user data structure with type "tIMparamsDb".
+  * @retval None
+  */
+void tIMparamsDb_swap(tIMparamsDb* ptIMparamsDb)
+{
+	tIMparams* ptActive = ptIMparamsDb->ptActive;
+	
+	IM_STORE_REL(ptIMparamsDb->ptActive, (ptActive == &ptIMparamsDb->asBuf[0]) ?
+		     &ptIMparamsDb->asBuf[1] : &ptIMparamsDb->asBuf[0]);
 }
 
 /**
@@ -65,21 +175,48 @@ void tIMparams_init(tIMparams* ptIMparams)
   *	    ptIMparams: pointer to user data structure with type "tIMparams".               
   * @retval None
   */
-void tIMstatObs_calc(tIMstatObs* ptIMstatObs, tIMparams* ptIMparams)
+void tIMstatObs_calc(tIMstatObs* ptIMstatObs, const tIMparams* IM_RESTRICT ptIMparams)
 {
 	float fDiffIsAl, fDiffIsBe;
 	
-	fDiffIsAl = (ptIMstatObs->fIsAl - ptIMstatObs->fPrevIsAl)/ptIMparams->fDt;
+	fDiffIsAl = ptIMstatObs->fIsAl - ptIMstatObs->fPrevIsAl;
 			ptIMstatObs->fPrevIsAl = ptIMstatObs->fIsAl;
 	
-	fDiffIsBe = (ptIMstatObs->fIsBe - ptIMstatObs->fPrevIsBe)/ptIMparams->fDt;
+	fDiffIsBe = ptIMstatObs->fIsBe - ptIMstatObs->fPrevIsBe;
 			ptIMstatObs->fPrevIsBe = ptIMstatObs->fIsBe;
 	
-	ptIMstatObs->fEsAl = (ptIMstatObs->fUsAl - ptIMparams->fRs*ptIMstatObs->fIsAl - 
-				ptIMparams->fSigLs*fDiffIsAl)*ptIMparams->f1divKr;
+	ptIMstatObs->fEsAl = imStatEmf(ptIMparams, ptIMstatObs->fUsAl,
+				       ptIMstatObs->fIsAl, fDiffIsAl);
 						
-	ptIMstatObs->fEsBe = (ptIMstatObs->fUsBe - ptIMparams->fRs*ptIMstatObs->fIsBe -
-				ptIMparams->fSigLs*fDiffIsBe)*ptIMparams->f1divKr;
+	ptIMstatObs->fEsBe = imStatEmf(ptIMparams, ptIMstatObs->fUsBe,
+				       ptIMstatObs->fIsBe, fDiffIsBe);
+}
+
+/**
+  * @brief  IM stator back-EMF observer calculation function with the filtered
+  *	    derivative of the stator current: the previous current is replaced by
+  *	    the output of the 1st order low-pass filter If (time constant fTdf),
+  *	    the derivative is the filter state derivative (Is - If)/(fTdf + fDt)
+  *	    (no difference of the raw samples divided by fDt, the noise gain is
+  *	    fDt/(fTdf + fDt) times lower). The same results as "tIMstatObs_calc"
+  *	    with fTdf = 0, the fPrevIsAl/fPrevIsBe are the filtered current.
+  * @param  ptIMstatObs: pointer to user data structure with type "tIMstatObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".               
+  * @retval None
+  */
+void tIMstatObs_calcFilt(tIMstatObs* ptIMstatObs,
+			 const tIMparams* IM_RESTRICT ptIMparams)
+{
+	float fDiffIsAl = ptIMstatObs->fIsAl - ptIMstatObs->fPrevIsAl;
+	float fDiffIsBe = ptIMstatObs->fIsBe - ptIMstatObs->fPrevIsBe;
+	
+	ptIMstatObs->fPrevIsAl = ptIMstatObs->fIsAl - ptIMparams->fDfK*fDiffIsAl;
+	ptIMstatObs->fPrevIsBe = ptIMstatObs->fIsBe - ptIMparams->fDfK*fDiffIsBe;
+	
+	ptIMstatObs->fEsAl = imStatEmfR(ptIMparams, ptIMstatObs->fUsAl, ptIMstatObs->fIsAl) -
+			     ptIMparams->fKrSigLsDivTf*fDiffIsAl;
+	ptIMstatObs->fEsBe = imStatEmfR(ptIMparams, ptIMstatObs->fUsBe, ptIMstatObs->fIsBe) -
+			     ptIMparams->fKrSigLsDivTf*fDiffIsBe;
 }
 
 /**
@@ -88,33 +225,530 @@ void tIMstatObs_calc(tIMstatObs* ptIMstatObs, tIMparams* ptIMparams)
   *	    ptIMparams: pointer to user data structure with type "tIMparams".               
   * @retval None
   */
-void tIMrotObs_calc(tIMrotObs* ptIMrotObs, tIMparams* ptIMparams)
+void tIMrotObs_calc(tIMrotObs* ptIMrotObs, const tIMparams* IM_RESTRICT ptIMparams)
 {
-	ptIMrotObs->fErAl = (ptIMrotObs->fIsAl*ptIMparams->fLm - ptIMrotObs->fFrAl)*
-				ptIMparams->f1divTr - ptIMrotObs->fWrE*ptIMrotObs->fFrBe;
+	ptIMrotObs->fErAl = imRotEmf(ptIMparams, ptIMrotObs->fIsAl, ptIMrotObs->fFrAl,
+				     ptIMrotObs->fWrE*ptIMrotObs->fFrBe);
 	
-	ptIMrotObs->fFrAl = ptIMrotObs->fPrevFrAl + 0.5f*ptIMparams->fDt*(
+	ptIMrotObs->fFrAl = ptIMrotObs->fPrevFrAl + ptIMparams->fHalfDt*(
 				ptIMrotObs->fErAl + ptIMrotObs->fPrevErAl);
 	ptIMrotObs->fPrevErAl = ptIMrotObs->fErAl;
 	ptIMrotObs->fPrevFrAl = ptIMrotObs->fFrAl;
 						
-	ptIMrotObs->fErBe = (ptIMrotObs->fIsBe*ptIMparams->fLm - ptIMrotObs->fFrBe)*
-				ptIMparams->f1divTr + ptIMrotObs->fWrE*ptIMrotObs->fFrAl;
+	ptIMrotObs->fErBe = imRotEmf(ptIMparams, ptIMrotObs->fIsBe, ptIMrotObs->fFrBe,
+				     -ptIMrotObs->fWrE*ptIMrotObs->fFrAl);
 
-	ptIMrotObs->fFrBe = ptIMrotObs->fPrevFrBe + 0.5f*ptIMparams->fDt*(
+	ptIMrotObs->fFrBe = ptIMrotObs->fPrevFrBe + ptIMparams->fHalfDt*(
 				ptIMrotObs->fErBe + ptIMrotObs->fPrevErBe);
 	ptIMrotObs->fPrevErBe = ptIMrotObs->fErBe;
 	ptIMrotObs->fPrevFrBe = ptIMrotObs->fFrBe;
 }
 
+/**
+  * @brief  Step of the discrete rotor model in the complex form (Fr = FrAl + j*FrBe,
+  *	    Is = IsAl + j*IsBe): Fr = Phi*Fr + Gam*Is, the rotor back-EMF is the
+  *	    mean flux derivative over the step.
+  * @param  ptIMrotObs: pointer to user data structure with type "tIMrotObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    fPhiRe, fPhiIm: flux transition coefficient,
+  *	    fGamRe, fGamIm: current input coefficient,
+  *	    fIsAl, fIsBe: current input.
+  * @retval None
+  */
+static inline void tIMrotObs_step(tIMrotObs* ptIMrotObs, const tIMparams* ptIMparams,
+				  float fPhiRe, float fPhiIm, float fGamRe, float fGamIm,
+				  float fIsAl, float fIsBe)
+{
+	float fFrAl = ptIMrotObs->fFrAl;
+	float fFrBe = ptIMrotObs->fFrBe;
+	
+	ptIMrotObs->fFrAl = fPhiRe*fFrAl - fPhiIm*fFrBe + fGamRe*fIsAl - fGamIm*fIsBe;
+	ptIMrotObs->fFrBe = fPhiIm*fFrAl + fPhiRe*fFrBe + fGamIm*fIsAl + fGamRe*fIsBe;
+	
+	ptIMrotObs->fErAl = (ptIMrotObs->fFrAl - fFrAl)*ptIMparams->f1divDt;
+	ptIMrotObs->fErBe = (ptIMrotObs->fFrBe - fFrBe)*ptIMparams->f1divDt;
+	
+	ptIMrotObs->fPrevErAl = ptIMrotObs->fErAl;
+	ptIMrotObs->fPrevErBe = ptIMrotObs->fErBe;
+	ptIMrotObs->fPrevFrAl = ptIMrotObs->fFrAl;
+	ptIMrotObs->fPrevFrBe = ptIMrotObs->fFrBe;
+	ptIMrotObs->fPrevIsAl = ptIMrotObs->fIsAl;
+	ptIMrotObs->fPrevIsBe = ptIMrotObs->fIsBe;
+}
+
+/**
+  * @brief  Step of the exact discretization of the rotor model with the given cos/sin
+  *	    of the flux rotation per step (fWrE*fDt).
+  * @param  ptIMrotObs: pointer to user data structure with type "tIMrotObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    fCos, fSin: cos/sin of the flux rotation per step.
+  * @retval None
+  */
+static inline void tIMrotObs_exact(tIMrotObs* ptIMrotObs, const tIMparams* ptIMparams,
+				   float fCos, float fSin)
+{
+	float fA = ptIMparams->f1divTr;
+	float fW = ptIMrotObs->fWrE;
+	float fExp = 1.0f + ptIMparams->fExpm1Dt;
+	// Phi - 1 without cancellation: cos - 1 = -sin^2/(1 + cos)
+#ifdef IM_WCET_PROFILE
+	float fCm1 = -fSin*fSin/(1.0f + fabsf(fCos));	// finite for both branches
+	float fDRe = ptIMparams->fExpm1Dt*fCos + IM_SELF(fCos > 0.0f, fCm1, fCos - 1.0f);
+#else
+	float fDRe = ptIMparams->fExpm1Dt*fCos +
+		     ((fCos > 0.0f) ? -fSin*fSin/(1.0f + fCos) : fCos - 1.0f);
+#endif
+	float fDIm = fExp*fSin;
+	float fK = ptIMparams->fLmDivTr/(fA*fA + fW*fW);
+	
+	tIMrotObs_step(ptIMrotObs, ptIMparams, fExp*fCos, fDIm,
+		       fK*(fW*fDIm - fA*fDRe), -fK*(fA*fDIm + fW*fDRe),
+		       0.5f*(ptIMrotObs->fIsAl + ptIMrotObs->fPrevIsAl),
+		       0.5f*(ptIMrotObs->fIsBe + ptIMrotObs->fPrevIsBe));
+}
+
+/**
+  * @brief  IM rotor back-EMF and flux observer calculation function with the exact
+  *	    discretization of the rotor model (matrix exponential for the constant
+  *	    speed over the step, the current is held at the mean of the step):
+  *	    Phi = exp(L*fDt), Gam = fLmDivTr*(Phi - 1)/L, L = -1/Tr + j*fWrE,
+  *	    stable at any fWrE*fDt.
+  * @param  ptIMrotObs: pointer to user data structure with type "tIMrotObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".               
+  * @retval None
+  */
+void tIMrotObs_calcExact(tIMrotObs* ptIMrotObs, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	float fTh = ptIMrotObs->fWrE*ptIMparams->fDt;
+#ifdef IM_WCET_PROFILE
+	float fCos, fSin;
+	
+	imSinCosf(fTh, &fCos, &fSin);
+	tIMrotObs_exact(ptIMrotObs, ptIMparams, fCos, fSin);
+#else
+	
+	tIMrotObs_exact(ptIMrotObs, ptIMparams, cosf(fTh), sinf(fTh));
+#endif
+}
+
+/**
+  * @brief  Build the IM rotor model coefficients table (cos/sin of the flux rotation
+  *	    per step over the speed range +-fWrMax).
+  * @param  ptIMrotLut: pointer to user data structure with type "tIMrotLut",
+  *	    fDt: discretization time of the rotor observer, Sec.
+  * @retval None
+  */
+void tIMrotLut_init(tIMrotLut* ptIMrotLut, float fDt)
+{
+	float fStep = 2.0f*ptIMrotLut->fWrMax/(float)(IM_ROT_LUT_SIZE - 1);
+	unsigned i;
+	
+	for(i = 0; i < IM_ROT_LUT_SIZE; i++)
+	{
+		float fTh = (-ptIMrotLut->fWrMax + (float)i*fStep)*fDt;
+		
+		ptIMrotLut->afCosSin[i][0] = cosf(fTh);
+		ptIMrotLut->afCosSin[i][1] = sinf(fTh);
+	}
+	ptIMrotLut->f1divStep = 1.0f/fStep;
+	ptIMrotLut->fDt = fDt;
+}
+
+/**
+  * @brief  IM rotor back-EMF and flux observer calculation function with the exact
+  *	    discretization of the rotor model and linear interpolation of the flux
+  *	    rotation cos/sin from the coefficients table "ptLut" (the table is not
+  *	    built here: the exact cos/sin while it is not built for fDt).
+  * @param  ptIMrotObs: pointer to user data structure with type "tIMrotObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".               
+  * @retval None
+  */
+void tIMrotObs_calcLut(tIMrotObs* ptIMrotObs, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	tIMrotLut* ptLut = ptIMrotObs->ptLut;
+	float fX;
+	int i;
+	
+	if((ptLut == 0) || (ptLut->fDt != ptIMparams->fDt))	// no table or stale
+	{
+		tIMrotObs_calcExact(ptIMrotObs, ptIMparams);
+		return;
+	}
+	
+	fX = (ptIMrotObs->fWrE + ptLut->fWrMax)*ptLut->f1divStep;
+	i = (int)fX;
+	if((fX >= 0.0f) && (i < IM_ROT_LUT_SIZE - 1))
+	{
+		const float* pfC = ptLut->afCosSin[i];
+		float fFrac = fX - (float)i;
+		float fCos = pfC[0] + fFrac*(pfC[2] - pfC[0]);
+		float fSin = pfC[1] + fFrac*(pfC[3] - pfC[1]);
+		// Newton step of the unit magnitude (the chord is inside of the circle,
+		// the magnitude error would be integrated to the flux error)
+		float fN = 1.5f - 0.5f*(fCos*fCos + fSin*fSin);
+		
+		tIMrotObs_exact(ptIMrotObs, ptIMparams, fN*fCos, fN*fSin);
+	}
+	else tIMrotObs_calcExact(ptIMrotObs, ptIMparams);	// out of the table range
+}
+
+/**
+  * @brief  IM rotor back-EMF and flux observer calculation function with bilinear
+  *	    discretization of the rotor model prewarped to the rotor speed (the
+  *	    flux rotation per step is exact): s = (z - 1)/(z + 1)/fC,
+  *	    fC = tan(fWrE*fDt/2)/fWrE, stable at any fWrE*fDt.
+  * @param  ptIMrotObs: pointer to user data structure with type "tIMrotObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".               
+  * @retval None
+  */
+void tIMrotObs_calcBilin(tIMrotObs* ptIMrotObs, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	float fA = ptIMparams->f1divTr;
+	float fW = ptIMrotObs->fWrE;
+	float fX = fW*ptIMparams->fHalfDt;
+#ifdef IM_WCET_PROFILE
+	float fCosX, fSinX, fTanDivX, fC;
+	
+	imSinCosf(fX, &fCosX, &fSinX);
+	fTanDivX = fSinX/(fCosX*fX);			// not selected for fX = 0
+	fC = ptIMparams->fHalfDt*IM_SELF(fabsf(fX) > 1.0e-3f, fTanDivX,
+					 1.0f + fX*fX*(1.0f/3.0f));
+#else
+	float fC = (fabsf(fX) > 1.0e-3f) ? ptIMparams->fHalfDt*tanf(fX)/fX :
+		   ptIMparams->fHalfDt*(1.0f + fX*fX*(1.0f/3.0f));
+#endif
+	// D = 1 - L*fC, N = 1 + L*fC, Phi = N/D, Gam = fLmDivTr*fC/D
+	float fDRe = 1.0f + fA*fC;
+	float fDIm = -fW*fC;
+	float fNRe = 1.0f - fA*fC;
+	float fNIm = fW*fC;
+	float f1divD = 1.0f/(fDRe*fDRe + fDIm*fDIm);
+	float fK = ptIMparams->fLmDivTr*fC*f1divD;
+	
+	tIMrotObs_step(ptIMrotObs, ptIMparams,
+		       (fNRe*fDRe + fNIm*fDIm)*f1divD, (fNIm*fDRe - fNRe*fDIm)*f1divD,
+		       fK*fDRe, -fK*fDIm,
+		       ptIMrotObs->fIsAl + ptIMrotObs->fPrevIsAl,
+		       ptIMrotObs->fIsBe + ptIMrotObs->fPrevIsBe);
+}
+
+/**
+  * @brief  IM rotor back-EMF and flux observer calculation function with the 2nd
+  *	    order Runge-Kutta (Heun) integration of the rotor model (the current
+  *	    is linear over the step), no trigonometric functions, for fWrE*fDt << 1.
+  * @param  ptIMrotObs: pointer to user data structure with type "tIMrotObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".               
+  * @retval None
+  */
+void tIMrotObs_calcRK2(tIMrotObs* ptIMrotObs, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	float fW = ptIMrotObs->fWrE;
+	float fDt = ptIMparams->fDt;
+	float fFrAl = ptIMrotObs->fFrAl;
+	float fFrBe = ptIMrotObs->fFrBe;
+	float fK1Al = imRotEmf(ptIMparams, ptIMrotObs->fPrevIsAl, fFrAl, fW*fFrBe);
+	float fK1Be = imRotEmf(ptIMparams, ptIMrotObs->fPrevIsBe, fFrBe, -fW*fFrAl);
+	float fPrAl = fFrAl + fDt*fK1Al;
+	float fPrBe = fFrBe + fDt*fK1Be;
+	float fK2Al = imRotEmf(ptIMparams, ptIMrotObs->fIsAl, fPrAl, fW*fPrBe);
+	float fK2Be = imRotEmf(ptIMparams, ptIMrotObs->fIsBe, fPrBe, -fW*fPrAl);
+	
+	ptIMrotObs->fErAl = 0.5f*(fK1Al + fK2Al);
+	ptIMrotObs->fErBe = 0.5f*(fK1Be + fK2Be);
+	ptIMrotObs->fFrAl = fFrAl + fDt*ptIMrotObs->fErAl;
+	ptIMrotObs->fFrBe = fFrBe + fDt*ptIMrotObs->fErBe;
+	
+	ptIMrotObs->fPrevErAl = ptIMrotObs->fErAl;
+	ptIMrotObs->fPrevErBe = ptIMrotObs->fErBe;
+	ptIMrotObs->fPrevFrAl = ptIMrotObs->fFrAl;
+	ptIMrotObs->fPrevFrBe = ptIMrotObs->fFrBe;
+	ptIMrotObs->fPrevIsAl = ptIMrotObs->fIsAl;
+	ptIMrotObs->fPrevIsBe = ptIMrotObs->fIsBe;
+}
+
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+/**
+  * @brief  Rotor flux angle, magnitude and sin/cos of the speed observer: exact
+  *	    (atan2) or tracked by the small rotation of the previous unit vector
+  *	    (cos, sin) to the flux vector (uAngTrack > 0).
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObs".
+  * @retval None
+  */
+static void tIMspeedObs_angle(tIMspeedObs* ptIMspeedObs)
+{
+	float fFrAl = ptIMspeedObs->sIMrotObs.fFrAl;
+	float fFrBe = ptIMspeedObs->sIMrotObs.fFrBe;
+	
+	if(ptIMspeedObs->uAngTrack && (++ptIMspeedObs->uAngTrackCnt < ptIMspeedObs->uAngTrack))
+	{
+		// flux vector in the tracked frame: D = |Fr|*cos(err), Q = |Fr|*sin(err)
+		float fD = fFrAl*ptIMspeedObs->fFrCos + fFrBe*ptIMspeedObs->fFrSin;
+		float fQ = fFrBe*ptIMspeedObs->fFrCos - fFrAl*ptIMspeedObs->fFrSin;
+		
+		if((fD > 0.0f) && (fabsf(fQ) <= ptIMspeedObs->fAngTrackTh*fD))
+		{
+			float fTan = fQ/fD;	// the only division of the tracking step
+			
+			imRotUnit(&ptIMspeedObs->fFrCos, &ptIMspeedObs->fFrSin, fTan);
+			ptIMspeedObs->fFrAng = imWrapPi(ptIMspeedObs->fFrAng +
+					fTan*(1.0f - fTan*fTan*(1.0f/3.0f)));
+			ptIMspeedObs->fFrMagn = fD + 0.5f*fQ*fTan;
+			return;
+		}
+	}
+	ptIMspeedObs->uAngTrackCnt = 0;
+	
+	imPolarf(fFrBe, fFrAl, &ptIMspeedObs->fFrAng, &ptIMspeedObs->fFrMagn);
+#ifdef IM_WCET_PROFILE
+	{
+		// the reciprocal of both paths (the zero vector gives (1, 0))
+		int iNz = ptIMspeedObs->fFrMagn > 0.0f;
+		float f1divMagn = 1.0f/IM_SELF(iNz, ptIMspeedObs->fFrMagn, 1.0f);
+		
+		ptIMspeedObs->fFrCos = IM_SELF(iNz, fFrAl*f1divMagn, 1.0f);
+		ptIMspeedObs->fFrSin = IM_SELF(iNz, fFrBe*f1divMagn, 0.0f);
+	}
+#else
+	if(ptIMspeedObs->fFrMagn > 0.0f)
+	{
+		float f1divMagn = 1.0f/ptIMspeedObs->fFrMagn;
+		
+		ptIMspeedObs->fFrCos = fFrAl*f1divMagn;
+		ptIMspeedObs->fFrSin = fFrBe*f1divMagn;
+	}
+	else
+	{
+		ptIMspeedObs->fFrCos = 1.0f;
+		ptIMspeedObs->fFrSin = 0.0f;
+	}
+#endif
+}
+#endif
+
+/**
+  * @brief  Sub-rate coefficients of IM parameters (uDecim*fDt discretization time),
+  *	    same values as of "tIMparams_init" with uDecim*fDt, and 1/uDecim of the
+  *	    flux angle extrapolation.
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".               
+  * @retval None
+  */
+static void tIMspeedObs_initSub(tIMspeedObs* ptIMspeedObs, const tIMparams* ptIMparams)
+{
+	tIMparamsSub* ptSub = &ptIMspeedObs->sIMparamsSub;
+	
+	ptSub->uSrcDecim = ptIMspeedObs->uDecim;
+	ptSub->fSrcDt = ptIMparams->fDt;
+	ptSub->fSrc1divTr = ptIMparams->f1divTr;
+	ptSub->fSrcSigLs = ptIMparams->fSigLs;
+	ptSub->fSrc1divKr = ptIMparams->f1divKr;
+	ptSub->fSrcTdf = ptIMparams->fTdf;
+	
+	ptSub->fDt = (float)ptIMspeedObs->uDecim*ptIMparams->fDt;
+	ptSub->f1divDt = 1.0f/ptSub->fDt;
+	ptSub->fHalfDt = 0.5f*ptSub->fDt;
+	ptSub->fKrSigLsDivDt = ptIMparams->fSigLs*ptSub->f1divDt*ptIMparams->f1divKr;
+	ptSub->fExpm1Dt = expm1f(-ptSub->fDt*ptIMparams->f1divTr);
+	ptSub->fDfK = ptIMparams->fTdf/(ptIMparams->fTdf + ptSub->fDt);
+	ptSub->fKrSigLsDivTf = ptSub->fKrSigLsDivDt*ptSub->fDt/
+			       (ptIMparams->fTdf + ptSub->fDt);
+	
+	ptIMspeedObs->f1divDecim = 1.0f/(float)ptIMspeedObs->uDecim;
+}
+
+/**
+  * @brief  IM rotor speed and flux observer initialization function: the sub-rate
+  *	    IM parameters and PI-controller discretization time (uDecim*fDt) are
+  *	    calculated, the rotor model table "sIMrotObs.ptLut" is built for this
+  *	    time. Must be called after the change of uDecim (not needed for the
+  *	    full rate observer with uDecim = 1 and sPI initialized by user), the
+  *	    change of IM parameters is detected by m_calc.
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".               
+  * @retval None
+  */
+void tIMspeedObs_init(tIMspeedObs* ptIMspeedObs, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	if(ptIMspeedObs->uDecim == 0) ptIMspeedObs->uDecim = 1;
+	
+	tIMspeedObs_initSub(ptIMspeedObs, ptIMparams);
+	
+	ptIMspeedObs->sPI.fDtSec = ptIMspeedObs->sIMparamsSub.fDt;
+	ptIMspeedObs->sPI.m_init(&ptIMspeedObs->sPI);
+	
+	if(ptIMspeedObs->sIMrotObs.ptLut &&
+	   (ptIMspeedObs->sIMrotObs.ptLut->fDt != ptIMspeedObs->sIMparamsSub.fDt))
+		tIMrotLut_init(ptIMspeedObs->sIMrotObs.ptLut, ptIMspeedObs->sIMparamsSub.fDt);
+	
+	ptIMspeedObs->uDecimCnt = 0;
+	ptIMspeedObs->fFrAngStep = 0.0f;
+}
+
+/**
+  * @brief  IM rotor speed and flux observer state seeding (e.g. by the startup
+  *	    identification, see "im_startup.h"): the rotor observer flux and
+  *	    back-EMF, the previous currents of the stator and rotor observers (by
+  *	    the current inputs fIsAl, fIsBe), the PI-controller integrator and the
+  *	    outputs are set, so the next m_calc continues from the given state
+  *	    without the transient of the zero flux and speed.
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    fWrE: rotor electrical speed, Rad/Sec,
+  *	    fFrAl: rotor flux Alpha, Wb,
+  *	    fFrBe: rotor flux Beta, Wb.
+  * @retval None
+  */
+void tIMspeedObs_seed(tIMspeedObs* ptIMspeedObs, const tIMparams* IM_RESTRICT ptIMparams,
+		      float fWrE, float fFrAl, float fFrBe)
+{
+	tIMrotObs* ptRot = &ptIMspeedObs->sIMrotObs;
+	tIMstatObs* ptStat = &ptIMspeedObs->sIMstatObs;
+	tPI* ptPI = &ptIMspeedObs->sPI;
+	float fIsAl = ptIMspeedObs->fIsAl;
+	float fIsBe = ptIMspeedObs->fIsBe;
+	
+	// Rotor observer: flux, back-EMF of the rotor model and previous current
+	ptRot->fIsAl = fIsAl;
+	ptRot->fIsBe = fIsBe;
+	ptRot->fWrE = fWrE;
+	ptRot->fFrAl = ptRot->fPrevFrAl = fFrAl;
+	ptRot->fFrBe = ptRot->fPrevFrBe = fFrBe;
+	ptRot->fErAl = ptRot->fPrevErAl = imRotEmf(ptIMparams, fIsAl, fFrAl, fWrE*fFrBe);
+	ptRot->fErBe = ptRot->fPrevErBe = imRotEmf(ptIMparams, fIsBe, fFrBe, -fWrE*fFrAl);
+	ptRot->fPrevIsAl = fIsAl;
+	ptRot->fPrevIsBe = fIsBe;
+	
+	// Stator observer: zero current derivative of the next step
+	ptStat->fPrevIsAl = fIsAl;
+	ptStat->fPrevIsBe = fIsBe;
+	
+	// PI-adapter: the integrator holds the speed (zero input of the last step)
+	ptPI->fIprevIn = 0.0f;
+	ptPI->fIout = ptPI->fIprevOut = fWrE;
+	ptPI->fOut = fWrE;
+	ptIMspeedObs->fWrE = fWrE;
+	
+	// Flux angle and magnitude, restart of the sub-rate and tracking counters
+	imPolarf(fFrBe, fFrAl, &ptIMspeedObs->fFrAng, &ptIMspeedObs->fFrMagn);
+	if(ptIMspeedObs->fFrMagn > 0.0f)
+	{
+		float f1divMagn = 1.0f/ptIMspeedObs->fFrMagn;
+		
+		ptIMspeedObs->fFrCos = fFrAl*f1divMagn;
+		ptIMspeedObs->fFrSin = fFrBe*f1divMagn;
+	}
+	else
+	{
+		ptIMspeedObs->fFrCos = 1.0f;
+		ptIMspeedObs->fFrSin = 0.0f;
+	}
+	ptIMspeedObs->fFrAngSub = ptIMspeedObs->fFrAng;
+	ptIMspeedObs->fFrAngStep = 0.0f;
+	ptIMspeedObs->uDecimCnt = 0;
+	ptIMspeedObs->uAngTrackCnt = 0;
+}
+
+/**
+  * @brief  Multi-rate IM rotor speed and flux observer calculation (uDecim > 1): the
+  *	    stator observer at every sample, the rotor observer and PI-controller
+  *	    at every uDecim-th sample, extrapolation of the flux angle between.
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".               
+  * @retval None
+  */
+static void tIMspeedObs_calcSub(tIMspeedObs* ptIMspeedObs,
+				const tIMparams* IM_RESTRICT ptIMparams)
+{
+	tIMparamsSub* ptSub = &ptIMspeedObs->sIMparamsSub;
+	tIMparams sIMparamsSub;
+	
+	ptIMspeedObs->sIMstatObs.fUsAl = ptIMspeedObs->fUsAl;
+	ptIMspeedObs->sIMstatObs.fUsBe = ptIMspeedObs->fUsBe;
+	ptIMspeedObs->sIMstatObs.fIsAl = ptIMspeedObs->fIsAl;
+	ptIMspeedObs->sIMstatObs.fIsBe = ptIMspeedObs->fIsBe;
+	
+	ptIMspeedObs->sIMstatObs.m_calc(&ptIMspeedObs->sIMstatObs, ptIMparams);
+	
+	if(++ptIMspeedObs->uDecimCnt < ptIMspeedObs->uDecim)
+	{
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+		float fStep = ptIMspeedObs->fFrAngStep;
+		
+		ptIMspeedObs->fFrAng = imWrapPi(ptIMspeedObs->fFrAng + fStep);
+		imRotUnit(&ptIMspeedObs->fFrCos, &ptIMspeedObs->fFrSin,
+			  fStep*(1.0f + fStep*fStep*(1.0f/3.0f)));
+#endif
+		return;
+	}
+	ptIMspeedObs->uDecimCnt = 0;
+	
+	if((ptIMspeedObs->uDecim != ptSub->uSrcDecim) ||	// new uDecim or
+	   (ptIMparams->fDt != ptSub->fSrcDt) ||		// new IM parameters
+	   (ptIMparams->f1divTr != ptSub->fSrc1divTr) ||	// (set or update)
+	   (ptIMparams->fSigLs != ptSub->fSrcSigLs) ||
+	   (ptIMparams->f1divKr != ptSub->fSrc1divKr) ||
+	   (ptIMparams->fTdf != ptSub->fSrcTdf))
+	{
+		tIMspeedObs_initSub(ptIMspeedObs, ptIMparams);
+		ptIMspeedObs->sPI.fDtSec = ptSub->fDt;	// used by the next sPI.m_calc
+	}
+	
+	// IM parameters of the sub-rate (the source ones with uDecim*fDt coefficients)
+	sIMparamsSub = *ptIMparams;
+	sIMparamsSub.fDt = ptSub->fDt;
+	sIMparamsSub.f1divDt = ptSub->f1divDt;
+	sIMparamsSub.fHalfDt = ptSub->fHalfDt;
+	sIMparamsSub.fKrSigLsDivDt = ptSub->fKrSigLsDivDt;
+	sIMparamsSub.fExpm1Dt = ptSub->fExpm1Dt;
+	sIMparamsSub.fDfK = ptSub->fDfK;
+	sIMparamsSub.fKrSigLsDivTf = ptSub->fKrSigLsDivTf;
+	
+	ptIMspeedObs->sIMrotObs.fIsAl = ptIMspeedObs->fIsAl;
+	ptIMspeedObs->sIMrotObs.fIsBe = ptIMspeedObs->fIsBe;
+	ptIMspeedObs->sIMrotObs.fWrE = ptIMspeedObs->fWrE;
+	
+	ptIMspeedObs->sIMrotObs.m_calc(&ptIMspeedObs->sIMrotObs, &sIMparamsSub);
+	
+	ptIMspeedObs->sPI.fIn = ptIMspeedObs->fIsAl*(ptIMspeedObs->sIMstatObs.fEsBe - 
+				ptIMspeedObs->sIMrotObs.fErBe) - ptIMspeedObs->fIsBe*(
+				ptIMspeedObs->sIMstatObs.fEsAl - 
+				ptIMspeedObs->sIMrotObs.fErAl);
+	
+	ptIMspeedObs->sPI.m_calc(&ptIMspeedObs->sPI);
+	
+	ptIMspeedObs->fWrE = ptIMspeedObs->sPI.fOut;
+	
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+	tIMspeedObs_angle(ptIMspeedObs);
+	
+	// flux rotation per sample (synchronous speed including the slip)
+	ptIMspeedObs->fFrAngStep = imWrapPi(ptIMspeedObs->fFrAng -
+				   ptIMspeedObs->fFrAngSub)*ptIMspeedObs->f1divDecim;
+	ptIMspeedObs->fFrAngSub = ptIMspeedObs->fFrAng;
+#endif
+}
+
 /**
   * @brief  IM rotor speed and flux observer calculation function
   * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
   *	    ptIMparams: pointer to user data structure with type "tIMparams".               
   * @retval None
   */
-void tIMspeedObs_calc(tIMspeedObs* ptIMspeedObs, tIMparams* ptIMparams)
+void tIMspeedObs_calc(tIMspeedObs* ptIMspeedObs, const tIMparams* IM_RESTRICT ptIMparams)
 {
+#ifdef IM_SPEED_OBS_TRACE
+	uint32_t uT0 = imCycles_now();
+	
+#endif
+	if(ptIMspeedObs->uDecim > 1)
+	{
+		tIMspeedObs_calcSub(ptIMspeedObs, ptIMparams);
+#ifdef IM_SPEED_OBS_TRACE
+		if(ptIMspeedObs->ptTrace) tIMspeedObs_trace(ptIMspeedObs, uT0);
+#endif
+		return;
+	}
+	
 	ptIMspeedObs->sIMstatObs.fUsAl = ptIMspeedObs->fUsAl;
 	ptIMspeedObs->sIMstatObs.fUsBe = ptIMspeedObs->fUsBe;
 	ptIMspeedObs->sIMstatObs.fIsAl = ptIMspeedObs->fIsAl;
@@ -137,11 +771,235 @@ void tIMspeedObs_calc(tIMspeedObs* ptIMspeedObs, tIMparams* ptIMparams)
 	
 	ptIMspeedObs->fWrE = ptIMspeedObs->sPI.fOut;
 	
-	ptIMspeedObs->fFrAng = atan2f(ptIMspeedObs->sIMrotObs.fFrBe,
-				ptIMspeedObs->sIMrotObs.fFrAl);
-									
-	ptIMspeedObs->fFrMagn = hypotf(ptIMspeedObs->sIMrotObs.fFrBe,
-					ptIMspeedObs->sIMrotObs.fFrAl);
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+	tIMspeedObs_angle(ptIMspeedObs);
+#endif
+
+#ifdef IM_SPEED_OBS_TRACE
+	if(ptIMspeedObs->ptTrace) tIMspeedObs_trace(ptIMspeedObs, uT0);
+#endif
+}
+
+/**
+  * @brief  IM rotor speed and flux observer calculation function with the input
+  *	    binding: the stator voltage and current are read through the "sBind"
+  *	    pointers, the stator and rotor observers (default m_calc) are fused
+  *	    without copies of the inputs to the observers data structures. The
+  *	    multi-rate mode, not default sub-observers m_calc and IM_SPEED_OBS_TRACE
+  *	    are served by "tIMspeedObs_calc" with the inputs copied (same results).
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".               
+  * @retval None
+  */
+void tIMspeedObs_calcBound(tIMspeedObs* ptIMspeedObs,
+			   const tIMparams* IM_RESTRICT ptIMparams)
+{
+	tIMstatObs* ptStat = &ptIMspeedObs->sIMstatObs;
+	tIMrotObs* ptRot = &ptIMspeedObs->sIMrotObs;
+	float fUsAl = *ptIMspeedObs->sBind.pfUsAl;
+	float fUsBe = *ptIMspeedObs->sBind.pfUsBe;
+	float fIsAl = *ptIMspeedObs->sBind.pfIsAl;
+	float fIsBe = *ptIMspeedObs->sBind.pfIsBe;
+	float fWrE = ptIMspeedObs->fWrE;
+	
+#ifndef IM_SPEED_OBS_TRACE
+	if((ptIMspeedObs->uDecim > 1) || (ptStat->m_calc != tIMstatObs_calc) ||
+	   (ptRot->m_calc != tIMrotObs_calc))
+#endif
+	{
+		ptIMspeedObs->fUsAl = fUsAl;
+		ptIMspeedObs->fUsBe = fUsBe;
+		ptIMspeedObs->fIsAl = fIsAl;
+		ptIMspeedObs->fIsBe = fIsBe;
+		tIMspeedObs_calc(ptIMspeedObs, ptIMparams);
+		return;
+	}
+	
+	// Stator observer (same operations as "tIMstatObs_calc")
+	ptStat->fEsAl = imStatEmf(ptIMparams, fUsAl, fIsAl, fIsAl - ptStat->fPrevIsAl);
+	ptStat->fEsBe = imStatEmf(ptIMparams, fUsBe, fIsBe, fIsBe - ptStat->fPrevIsBe);
+	ptStat->fPrevIsAl = fIsAl;
+	ptStat->fPrevIsBe = fIsBe;
+	
+	// Rotor observer (same operations as "tIMrotObs_calc")
+	ptRot->fWrE = fWrE;
+	ptRot->fErAl = imRotEmf(ptIMparams, fIsAl, ptRot->fFrAl, fWrE*ptRot->fFrBe);
+	ptRot->fFrAl = ptRot->fPrevFrAl + ptIMparams->fHalfDt*(ptRot->fErAl +
+		       ptRot->fPrevErAl);
+	ptRot->fPrevErAl = ptRot->fErAl;
+	ptRot->fPrevFrAl = ptRot->fFrAl;
+	ptRot->fErBe = imRotEmf(ptIMparams, fIsBe, ptRot->fFrBe, -fWrE*ptRot->fFrAl);
+	ptRot->fFrBe = ptRot->fPrevFrBe + ptIMparams->fHalfDt*(ptRot->fErBe +
+		       ptRot->fPrevErBe);
+	ptRot->fPrevErBe = ptRot->fErBe;
+	ptRot->fPrevFrBe = ptRot->fFrBe;
+	
+	ptIMspeedObs->sPI.fIn = fIsAl*(ptStat->fEsBe - ptRot->fErBe) - 
+				fIsBe*(ptStat->fEsAl - ptRot->fErAl);
+	ptIMspeedObs->sPI.m_calc(&ptIMspeedObs->sPI);
+	ptIMspeedObs->fWrE = ptIMspeedObs->sPI.fOut;
+	
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+	tIMspeedObs_angle(ptIMspeedObs);
+#endif
+}
+
+/**
+  * @brief  IM rotor speed and flux observer calculation of the block of samples
+  *	    (offline replay of captured signals). The result is the same as
+  *	    "uNum" calls of "tIMspeedObs_calc" (the state of observer is kept
+  *	    between blocks), but the state variables and coefficients are held in
+  *	    the local variables and the function pointers are not used (the
+  *	    observers with not default m_calc of the stator/rotor observers or
+  *	    PI-adapter, multi-rate, angle tracking or trace are calculated by
+  *	    "tIMspeedObs_calc" per sample).
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    ptIn: pointer to the input signals views with type "tIMblockIn",
+  *	    ptOut: pointer to the output signals views with type "tIMblockOut",
+  *	    uNum: count of samples.
+  * @retval None
+  */
+void tIMspeedObs_calcBlock(tIMspeedObs* ptIMspeedObs,
+			   const tIMparams* IM_RESTRICT ptIMparams,
+			   const tIMblockIn* ptIn, const tIMblockOut* ptOut,
+			   unsigned uNum)
+{
+	const float f1divKr = ptIMparams->f1divKr;
+	const float fKrRs = ptIMparams->fKrRs;
+	const float fKrSigLsDivDt = ptIMparams->fKrSigLsDivDt;
+	const float fLmDivTr = ptIMparams->fLmDivTr;
+	const float f1divTr = ptIMparams->f1divTr;
+	const float fHalfDt = ptIMparams->fHalfDt;
+	const float fKp = ptIMspeedObs->sPI.fKp;
+	const float fKi = ptIMspeedObs->sPI.fKi;
+	const float fUpOutLim = ptIMspeedObs->sPI.fUpOutLim;
+	const float fLowOutLim = ptIMspeedObs->sPI.fLowOutLim;
+	float fPIhalfDt, fAwKdt, fAwClamp;
+	float fPrevIsAl = ptIMspeedObs->sIMstatObs.fPrevIsAl;
+	float fPrevIsBe = ptIMspeedObs->sIMstatObs.fPrevIsBe;
+	float fPrevErAl = ptIMspeedObs->sIMrotObs.fPrevErAl;
+	float fPrevErBe = ptIMspeedObs->sIMrotObs.fPrevErBe;
+	float fFrAl = ptIMspeedObs->sIMrotObs.fFrAl;
+	float fFrBe = ptIMspeedObs->sIMrotObs.fFrBe;
+	float fIprevIn = ptIMspeedObs->sPI.fIprevIn;
+	float fIout = ptIMspeedObs->sPI.fIprevOut;
+	float fWrE = ptIMspeedObs->fWrE;
+	float fUsAl = 0.0f, fUsBe = 0.0f, fIsAl = 0.0f, fIsBe = 0.0f;
+	float fEsAl = 0.0f, fEsBe = 0.0f, fErAl = 0.0f, fErBe = 0.0f, fIn = 0.0f;
+	float fPout = 0.0f, fWrEprev = fWrE, fIprevOut, fPreOut, fErr;
+	unsigned uIn = 0, uOut = 0, n;
+	
+	if(uNum == 0) return;
+	
+	if((ptIMspeedObs->uDecim > 1) || ptIMspeedObs->uAngTrack ||	// multi-rate, angle
+	   (ptIMspeedObs->sIMstatObs.m_calc != tIMstatObs_calc) ||	// tracking mode, not
+	   (ptIMspeedObs->sIMrotObs.m_calc != tIMrotObs_calc) ||	// default stator or
+	   (ptIMspeedObs->sPI.m_calc != tPI_calc)			// rotor observer or
+#ifdef IM_SPEED_OBS_TRACE						// PI-adapter, traced
+	   || ptIMspeedObs->ptTrace					// steps
+#endif
+	   )
+	{
+		for(n = 0; n < uNum; n++, uIn += ptIn->uStride, uOut += ptOut->uStride)
+		{
+			ptIMspeedObs->fUsAl = ptIn->pfUsAl[uIn];
+			ptIMspeedObs->fUsBe = ptIn->pfUsBe[uIn];
+			ptIMspeedObs->fIsAl = ptIn->pfIsAl[uIn];
+			ptIMspeedObs->fIsBe = ptIn->pfIsBe[uIn];
+			tIMspeedObs_calc(ptIMspeedObs, ptIMparams);
+			if(ptOut->pfWrE) ptOut->pfWrE[uOut] = ptIMspeedObs->fWrE;
+			if(ptOut->pfFrAng) ptOut->pfFrAng[uOut] = ptIMspeedObs->fFrAng;
+			if(ptOut->pfFrMagn) ptOut->pfFrMagn[uOut] = ptIMspeedObs->fFrMagn;
+		}
+		return;
+	}
+	
+	// coefficients of the PI-adapter (same as "tPI_calc" after the change of fDtSec)
+	if(ptIMspeedObs->sPI.fDtSec != ptIMspeedObs->sPI.fDtInit) tPI_init(&ptIMspeedObs->sPI);
+	fPIhalfDt = ptIMspeedObs->sPI.fHalfDt;
+	fAwKdt = ptIMspeedObs->sPI.fAwKdt;
+	fAwClamp = ptIMspeedObs->sPI.fAwClamp;
+	
+	for(n = 0; n < uNum; n++, uIn += ptIn->uStride, uOut += ptOut->uStride)
+	{
+		fUsAl = ptIn->pfUsAl[uIn];
+		fUsBe = ptIn->pfUsBe[uIn];
+		fIsAl = ptIn->pfIsAl[uIn];
+		fIsBe = ptIn->pfIsBe[uIn];
+		
+		// stator back-EMF observer (same operations as "imStatEmf"/"imRotEmf" with
+		// the coefficients held in the local variables)
+		fEsAl = fUsAl*f1divKr - fKrRs*fIsAl - fKrSigLsDivDt*(fIsAl - fPrevIsAl);
+		fEsBe = fUsBe*f1divKr - fKrRs*fIsBe - fKrSigLsDivDt*(fIsBe - fPrevIsBe);
+		fPrevIsAl = fIsAl;
+		fPrevIsBe = fIsBe;
+		
+		// rotor back-EMF and flux observer
+		fWrEprev = fWrE;
+		fErAl = fIsAl*fLmDivTr - fFrAl*f1divTr - fWrE*fFrBe;
+		fFrAl = fFrAl + fHalfDt*(fErAl + fPrevErAl);
+		fPrevErAl = fErAl;
+		
+		fErBe = fIsBe*fLmDivTr - fFrBe*f1divTr + fWrE*fFrAl;
+		fFrBe = fFrBe + fHalfDt*(fErBe + fPrevErBe);
+		fPrevErBe = fErBe;
+		
+		// PI-adapter of rotor speed
+		fIn = fIsAl*(fEsBe - fErBe) - fIsBe*(fEsAl - fErAl);
+		fPout = fIn*fKp;
+		fIprevOut = fIout;
+		fIout = fIout + fPIhalfDt*(fPout*fKi + fIprevIn);
+		fIprevIn = fPout;
+		
+		fPreOut = fPout + fIout;
+		fWrE = PID_SATF(fPreOut, fLowOutLim, fUpOutLim);
+		
+		// anti-windup of the PI-adapter (same as "tPI_calc")
+		fErr = fWrE - fPreOut;
+		fIout = fIout + fAwKdt*fErr;
+		fIout = (fErr*(fIout - fIprevOut)*fAwClamp < 0.0f) ? fIprevOut : fIout;
+		
+		if(ptOut->pfWrE) ptOut->pfWrE[uOut] = fWrE;
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+		if(ptOut->pfFrAng || ptOut->pfFrMagn)
+		{
+			float fFrAng, fFrMagn;
+			
+			imPolarf(fFrBe, fFrAl, &fFrAng, &fFrMagn);
+			if(ptOut->pfFrAng) ptOut->pfFrAng[uOut] = fFrAng;
+			if(ptOut->pfFrMagn) ptOut->pfFrMagn[uOut] = fFrMagn;
+		}
+#endif
+	}
+	
+	// store the state of the observer (same as after the last "tIMspeedObs_calc")
+	ptIMspeedObs->fUsAl = ptIMspeedObs->sIMstatObs.fUsAl = fUsAl;
+	ptIMspeedObs->fUsBe = ptIMspeedObs->sIMstatObs.fUsBe = fUsBe;
+	ptIMspeedObs->fIsAl = ptIMspeedObs->sIMstatObs.fIsAl = fIsAl;
+	ptIMspeedObs->fIsBe = ptIMspeedObs->sIMstatObs.fIsBe = fIsBe;
+	ptIMspeedObs->sIMstatObs.fPrevIsAl = fPrevIsAl;
+	ptIMspeedObs->sIMstatObs.fPrevIsBe = fPrevIsBe;
+	ptIMspeedObs->sIMstatObs.fEsAl = fEsAl;
+	ptIMspeedObs->sIMstatObs.fEsBe = fEsBe;
+	
+	ptIMspeedObs->sIMrotObs.fIsAl = fIsAl;
+	ptIMspeedObs->sIMrotObs.fIsBe = fIsBe;
+	ptIMspeedObs->sIMrotObs.fWrE = fWrEprev;
+	ptIMspeedObs->sIMrotObs.fPrevErAl = ptIMspeedObs->sIMrotObs.fErAl = fErAl;
+	ptIMspeedObs->sIMrotObs.fPrevErBe = ptIMspeedObs->sIMrotObs.fErBe = fErBe;
+	ptIMspeedObs->sIMrotObs.fPrevFrAl = ptIMspeedObs->sIMrotObs.fFrAl = fFrAl;
+	ptIMspeedObs->sIMrotObs.fPrevFrBe = ptIMspeedObs->sIMrotObs.fFrBe = fFrBe;
+	
+	ptIMspeedObs->sPI.fIn = fIn;
+	ptIMspeedObs->sPI.fPout = fPout;
+	ptIMspeedObs->sPI.fIprevIn = fIprevIn;
+	ptIMspeedObs->sPI.fIout = ptIMspeedObs->sPI.fIprevOut = fIout;
+	ptIMspeedObs->sPI.fOut = ptIMspeedObs->fWrE = fWrE;
+	
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+	tIMspeedObs_angle(ptIMspeedObs);
+#endif
 }
 
 /*********************************** END OF FILE ***********************************/
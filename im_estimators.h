@@ -43,7 +43,28 @@ extern "C" {
 
 /* Includes -----------------------------------------------------------------------*/
 #include "fp_pid.h" // P/I/D-controllers library
+#include "im_fast_math.h" // Fast vector angle and magnitude calculation
 #include <math.h>	
+#ifdef IM_SPEED_OBS_TRACE
+#include "im_trace.h" // Run-time instrumentation of estimators
+#endif
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Qualifier of the IM parameters pointer of the estimators functions: the
+  *	   parameters are read only and not aliased by the estimator state during
+  *	   the call (one parameters set may be shared by many estimators).
+  */
+#ifndef IM_RESTRICT
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L) && !defined(__cplusplus)
+#define IM_RESTRICT		restrict
+#elif defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#define IM_RESTRICT		__restrict
+#else
+#define IM_RESTRICT
+#endif
+#endif
 
 /* Exported types -----------------------------------------------------------------*/
 
@@ -60,14 +81,42 @@ typedef struct sIMparams
 	float fLs;				// Stator inductance, H
 	float fLr;				// Rotor inductance, H
 	float fLm;				// Magnetizing inductance, H
+	float fTdf;				// Time constant of the stator current
+						// derivative filter, Sec
+						// ("tIMstatObs_calcFilt")
 // Internal variables:
 	float f1divTr;				// fRr/fLr
 	float f1divKr;				// fLr/fLm
 	float fSigLs;				// (1 - (fLm^2)/(fLs*fLr)) * fLs
+	float f1divDt;				// 1/fDt
+	float fHalfDt;				// 0.5*fDt
+	float fKrRs;				// fRs*f1divKr
+	float fKrSigLsDivDt;			// fSigLs/fDt*f1divKr
+	float fLmDivTr;				// fLm*f1divTr
+	float fExpm1Dt;				// exp(-fDt*f1divTr) - 1
+	float fDfK;				// fTdf/(fTdf + fDt)
+	float fKrSigLsDivTf;			// fKrSigLsDivDt*fDt/(fTdf + fDt)
 // Functions:
 	void  (*m_init)(struct sIMparams*);	// Pointer to Init() function
 } tIMparams;
 
+/** 
+  * @brief "Double-buffered IM parameters" data structure: the estimators use the
+  *	   active set, a background task prepares the back set and publishes it
+  *	   by the pointer swap. The reader acknowledges the used set, so the
+  *	   writer reuses the old set only after the reader has left it (single
+  *	   writer and single reader, lock-free on single and multi-core systems,
+  *	   the ISR is not blocked and never sees a half-updated set).
+  */
+typedef struct sIMparamsDb
+{
+	tIMparams	asBuf[2];		// Parameters sets (active and back)
+	tIMparams* volatile ptActive;		// Pointer to active parameters set
+						// (written by the writer)
+	tIMparams* volatile ptUsed;		// Pointer to used parameters set
+						// (written by the reader)
+} tIMparamsDb;
+
 /** 
   * @brief "IM sensorless stator back-EMF observer Module" data structure
   */
@@ -88,11 +137,52 @@ typedef struct sIMstatObs
 	float		fEsBe;			// Stator back-EMF Beta, Volts
 // Functions:
 	void	(*m_calc)(struct sIMstatObs*,	// Pointer to estimator function
-				tIMparams*);	
+				const tIMparams* IM_RESTRICT);	
 } tIMstatObs;
 
+/**
+  * @brief Size and placement of the rotor model coefficients table, can be overridden
+  *	   by the user at compile time:
+  *	   IM_ROT_LUT_SIZE    - count of the table points over the speed range (the
+  *				table footprint is 8*IM_ROT_LUT_SIZE bytes, the max
+  *				angle error of the interpolated and normalized flux
+  *				rotation per step is (fDt*2*fWrMax/(IM_ROT_LUT_SIZE
+  *				- 1))^3/12 approx.);
+  *	   IM_ROT_LUT_SECTION - attribute of the table variables declaration, e.g.
+  *				__attribute__((section(".ccmram"))) for the core
+  *				coupled RAM (STM32F3/F4) or the DTCM (Cortex-M7).
+  */
+#ifndef IM_ROT_LUT_SIZE
+#define IM_ROT_LUT_SIZE		65
+#endif
+
+#ifndef IM_ROT_LUT_SECTION
+#define IM_ROT_LUT_SECTION
+#endif
+
+/** 
+  * @brief "IM rotor model coefficients table" data structure: cos/sin of the flux
+  *	   rotation per step (fWrE*fDt) at the uniform grid of rotor speed, the
+  *	   table depends on fDt only (not on the rotor time constant), so it stays
+  *	   valid after the resistances update, one table per fDt (not shared by
+  *	   the rotor observers of different fDt, e.g. of multi-rate observers)
+  */
+typedef struct sIMrotLut
+{
+// Inputs:
+	float		fWrMax;			// Speed range of the table +-fWrMax,
+						// Rad/Sec
+// Internal variables:
+	float		fDt;			// Discretization time of the table, Sec
+						// (0 - not built, other than fDt
+						// of m_calc - stale)
+	float		f1divStep;		// 1/(grid step of rotor speed)
+	float		afCosSin[IM_ROT_LUT_SIZE][2];	// cos/sin of the rotation
+} tIMrotLut;
+
 /** 
-  * @brief "IM sensored rotor flux & back-EMF observer Module" data structure
+  * @brief "IM sensored rotor flux & back-EMF observer Module" data structure, m_calc
+  *	   selects the discretization of the rotor model (see the prototypes)
   */
 typedef struct sIMrotObs
 {
@@ -100,6 +190,10 @@ typedef struct sIMrotObs
 	float		fIsAl;			// Stator current Alpha, A
 	float		fIsBe;			// Stator current Beta, A
 	float		fWrE;			// Rotor electrical speed, Rad/Sec
+	tIMrotLut*	ptLut;			// Coefficients table of m_calc
+						// "tIMrotObs_calcLut" (NULL - exact),
+						// built by "tIMrotLut_init" or m_init
+						// of the speed observer, not in m_calc
 // Internal variables:
 	float		fPrevErAl;		// Previous value of rotor back-EMF
 						// Alpha, Volts
@@ -109,16 +203,60 @@ typedef struct sIMrotObs
 						// Alpha, Wb
 	float		fPrevFrBe;		// Previous value of rotor flux
 						// Beta, Wb
+	float		fPrevIsAl;		// Previous value of stator current
+						// Alpha, A (not trapezoidal m_calc)
+	float		fPrevIsBe;		// Previous value of stator current
+						// Beta, A (not trapezoidal m_calc)
 // Outputs:
 	float		fFrAl;			// Rotor flux Alpha, Wb
 	float		fFrBe;			// Rotor flux Beta, Wb
-	float		fErAl;			// Rotor back-EMF Alpha, Volts
-	float		fErBe;			// Rotor back-EMF Beta, Volts
+	float		fErAl;			// Rotor back-EMF Alpha, Volts (mean of
+						// the step, not trapezoidal m_calc)
+	float		fErBe;			// Rotor back-EMF Beta, Volts (mean of
+						// the step, not trapezoidal m_calc)
 // Functions:
 	void	(*m_calc)(struct sIMrotObs*,	// Pointer to estimator function
-				tIMparams*);	
+				const tIMparams* IM_RESTRICT);	
 } tIMrotObs;
 
+/** 
+  * @brief "IM speed observer input binding" data structure (pointers to the signals
+  *	   of the current step in the caller memory, e.g. the alpha/beta structure
+  *	   shared with the ADC/PWM ISR or the DMA results converted to floats)
+  */
+typedef struct sIMbind
+{
+	const float*	pfUsAl;			// Stator voltage Alpha, Volts
+	const float*	pfUsBe;			// Stator voltage Beta, Volts
+	const float*	pfIsAl;			// Stator current Alpha, A
+	const float*	pfIsBe;			// Stator current Beta, A
+} tIMbind;
+
+/** 
+  * @brief "IM parameters of the sub-rate" data structure: the discretization time
+  *	   dependent coefficients of uDecim*fDt, the others are used from the source
+  *	   IM parameters of m_calc. Recalculated when the source values below change
+  *	   (new pointer or in-place update, e.g. by "tIMparams_updR", or new uDecim).
+  */
+typedef struct sIMparamsSub
+{
+// Inputs:
+	unsigned uSrcDecim;			// uDecim of the observer
+	float	fSrcDt;				// fDt of the source
+	float	fSrc1divTr;			// f1divTr of the source
+	float	fSrcSigLs;			// fSigLs of the source
+	float	fSrc1divKr;			// f1divKr of the source
+	float	fSrcTdf;			// fTdf of the source
+// Outputs:
+	float	fDt;				// uDecim*fDt, Sec
+	float	f1divDt;			// 1/fDt
+	float	fHalfDt;			// 0.5*fDt
+	float	fKrSigLsDivDt;			// fSigLs/fDt*f1divKr
+	float	fExpm1Dt;			// exp(-fDt*f1divTr) - 1
+	float	fDfK;				// fTdf/(fTdf + fDt)
+	float	fKrSigLsDivTf;			// fKrSigLsDivDt*fDt/(fTdf + fDt)
+} tIMparamsSub;
+
 /** 
   * @brief "IM sensorless rotor speed & flux observer Module" data structure
   */
@@ -129,19 +267,73 @@ typedef struct sIMspeedObs
 	float		fUsBe;			// Stator voltage Beta, Volts
 	float		fIsAl;			// Stator current Alpha, A
 	float		fIsBe;			// Stator current Beta, A
+	unsigned	uDecim;			// Sub-rate divider of rotor observer
+						// and PI-controller (1 - full rate,
+						// m_init after change), the flux angle
+						// is extrapolated between sub-rate steps
+	unsigned	uAngTrack;		// Period of the exact flux angle resync
+						// (0 - exact angle at every step), the
+						// angle is tracked between (no atan2)
+	float		fAngTrackTh;		// Max flux angle correction per step of
+						// the tracking (resync above), Rad
+	tIMbind		sBind;			// Input signals binding of m_calc
+						// "tIMspeedObs_calcBound" (the inputs
+						// above are not written)
 // Internal variables:
 	tIMstatObs	sIMstatObs;		// Stator observer data structure
 	tIMrotObs	sIMrotObs;		// Rotor observer data structure
 	tPI		sPI;			// PI-controller data structure
+	tIMparamsSub	sIMparamsSub;		// IM parameters of the sub-rate
+	unsigned	uDecimCnt;		// Sub-rate steps counter
+	float		f1divDecim;		// 1/uDecim (with sIMparamsSub)
+	float		fFrAngSub;		// Rotor flux angle of the last sub-rate
+						// step, Rad
+	float		fFrAngStep;		// Rotor flux angle increment per sample
+						// (extrapolation), Rad
+	unsigned	uAngTrackCnt;		// Steps counter of the angle tracking
+#ifdef IM_SPEED_OBS_TRACE
+	tIMtrace*	ptTrace;		// Pointer to trace data structure
+						// (NULL - not traced)
+#endif
 // Outputs:
 	float		fWrE;			// Rotor electrical speed, Rad/Sec
 	float		fFrAng;			// Rotor flux angle, Rad
 	float		fFrMagn;		// Rotor flux magnitude, Wb
+	float		fFrCos;			// cos(fFrAng) for Park transforms
+	float		fFrSin;			// sin(fFrAng) for Park transforms
 // Functions:
+	void	(*m_init)(struct sIMspeedObs*,	// Pointer to initialization function
+				const tIMparams* IM_RESTRICT);
 	void	(*m_calc)(struct sIMspeedObs*,	// Pointer to estimator function
-				tIMparams*);
+				const tIMparams* IM_RESTRICT);
 } tIMspeedObs;
 
+/** 
+  * @brief "IM input signals block" data structure (strided views of N samples,
+  *	   e.g. uStride = 1 for separate arrays or uStride = 4 for interleaved
+  *	   {UsAl, UsBe, IsAl, IsBe} records)
+  */
+typedef struct sIMblockIn
+{
+	const float*	pfUsAl;			// Stator voltage Alpha samples, Volts
+	const float*	pfUsBe;			// Stator voltage Beta samples, Volts
+	const float*	pfIsAl;			// Stator current Alpha samples, A
+	const float*	pfIsBe;			// Stator current Beta samples, A
+	unsigned	uStride;		// Distance between samples (in floats)
+} tIMblockIn;
+
+/** 
+  * @brief "IM speed observer output signals block" data structure (strided views
+  *	   of N samples, NULL pointer - the output is not stored)
+  */
+typedef struct sIMblockOut
+{
+	float*		pfWrE;			// Rotor electrical speed, Rad/Sec
+	float*		pfFrAng;		// Rotor flux angle, Rad
+	float*		pfFrMagn;		// Rotor flux magnitude, Wb
+	unsigned	uStride;		// Distance between samples (in floats)
+} tIMblockOut;
+
 /* Exported constants -------------------------------------------------------------*/
 
 /** 
@@ -155,9 +347,18 @@ typedef struct sIMspeedObs
 	.fLs		= 0.0f,			\
 	.fLr		= 0.0f,			\
 	.fLm		= 0.0f,			\
+	.fTdf		= 0.0f,			\
 	.f1divTr	= 0.0f,			\
 	.f1divKr	= 0.0f,			\
 	.fSigLs		= 0.0f,			\
+	.f1divDt	= 1.0f,			\
+	.fHalfDt	= 0.5f,			\
+	.fKrRs		= 0.0f,			\
+	.fKrSigLsDivDt	= 0.0f,			\
+	.fLmDivTr	= 0.0f,			\
+	.fExpm1Dt	= 0.0f,			\
+	.fDfK		= 0.0f,			\
+	.fKrSigLsDivTf	= 0.0f,			\
 	.m_init		= tIMparams_init	\
 }
 
@@ -176,6 +377,14 @@ typedef struct sIMspeedObs
 	.m_calc		= tIMstatObs_calc	\
 }
 
+/** 
+  * @brief Initialization constant with defaults for "tIMrotLut" user variables
+  */
+#define IM_ROT_LUT_DEFAULTS {			\
+	.fWrMax		= 2000.0f,		\
+	.fDt		= 0.0f			\
+}
+
 /** 
   * @brief Initialization constant with defaults for "tIMrotObs" user variables
   */
@@ -183,10 +392,13 @@ typedef struct sIMspeedObs
 	.fIsAl		= 0.0f,			\
 	.fIsBe		= 0.0f,			\
 	.fWrE		= 0.0f,			\
+	.ptLut		= 0,			\
 	.fPrevErAl	= 0.0f,			\
 	.fPrevErBe	= 0.0f,			\
 	.fPrevFrAl	= 0.0f,			\
 	.fPrevFrBe	= 0.0f,			\
+	.fPrevIsAl	= 0.0f,			\
+	.fPrevIsBe	= 0.0f,			\
 	.fFrAl		= 0.0f,			\
 	.fFrBe		= 0.0f,			\
 	.fErAl		= 0.0f,			\
@@ -194,6 +406,16 @@ typedef struct sIMspeedObs
 	.m_calc		= tIMrotObs_calc	\
 }
 
+/** 
+  * @brief Initialization of the instrumentation fields of "tIMspeedObs"
+  */
+#ifdef IM_SPEED_OBS_TRACE
+#define IM_SPEED_OBS_TRACE_DEFAULTS		\
+	.ptTrace	= 0,
+#else
+#define IM_SPEED_OBS_TRACE_DEFAULTS
+#endif
+
 /** 
   * @brief Initialization constant with defaults for "tIMspeedObs" user variables
   */
@@ -202,29 +424,172 @@ typedef struct sIMspeedObs
 	.fUsBe		= 0.0f,			\
 	.fIsAl		= 0.0f,			\
 	.fIsBe		= 0.0f,			\
+	.uDecim		= 1,			\
+	.uAngTrack	= 0,			\
+	.fAngTrackTh	= 0.05f,		\
+	.sBind		= {0, 0, 0, 0},		\
 	.sIMstatObs	= IM_STAT_OBS_DEFAULTS,	\
 	.sIMrotObs	= IM_ROT_OBS_DEFAULTS,	\
 	.sPI		= PI_DEFAULTS,		\
+	.sIMparamsSub	= {0},			\
+	.uDecimCnt	= 0,			\
+	.f1divDecim	= 1.0f,			\
+	.fFrAngSub	= 0.0f,			\
+	.fFrAngStep	= 0.0f,			\
+	.uAngTrackCnt	= 0,			\
+	IM_SPEED_OBS_TRACE_DEFAULTS		\
 	.fWrE		= 0.0f,			\
 	.fFrAng		= 0.0f,			\
 	.fFrMagn	= 0.0f,			\
+	.fFrCos		= 1.0f,			\
+	.fFrSin		= 0.0f,			\
+	.m_init		= tIMspeedObs_init,	\
 	.m_calc		= tIMspeedObs_calc	\
 }
 
 /* Exported macro -----------------------------------------------------------------*/
+
+/**
+  * @brief Define the IM_SPEED_OBS_NO_FLUX_POLAR at compile time to skip the rotor
+  *	   flux angle and magnitude calculation of the speed observers (fFrAng and
+  *	   fFrMagn outputs are not updated) when only the rotor speed is needed.
+  *	   The accuracy of the flux angle and magnitude is selected by IM_FAST_MATH
+  *	   (see "im_fast_math.h").
+  */
+
+/**
+  * @brief Define the IM_SPEED_OBS_TRACE at compile time to enable the run-time
+  *	   instrumentation of the speed observers with not NULL "ptTrace" (see
+  *	   "im_trace.h"), without it no code and data are added.
+  */
+
+/**
+  * @brief Ordering of the shared data accesses between the ISR and background task
+  *	   (release store after the data update, acquire load before the use)
+  */
+#if defined(__GNUC__) || defined(__clang__)
+#define IM_LOAD_ACQ(x)			__atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define IM_STORE_REL(x, v)		__atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define IM_LOAD_ACQ(x)			(x)
+#define IM_STORE_REL(x, v)		((x) = (v))
+#endif
+
 /* Exported functions -------------------------------------------------------------*/
 
 /* IM parameters initialization function prototype *********************************/
 void tIMparams_init(tIMparams*);
 
+/* IM parameters incremental update of resistances function prototype *************/
+void tIMparams_updR(tIMparams*, float, float);
+
+/* Double-buffered IM parameters initialization function prototype *****************/
+void tIMparamsDb_init(tIMparamsDb*, const tIMparams*);
+
+/* Back IM parameters set (copy of the active one) for update function prototype ***/
+tIMparams* tIMparamsDb_back(tIMparamsDb*);
+
+/* Publish the back IM parameters set function prototype ***************************/
+void tIMparamsDb_swap(tIMparamsDb*);
+
+/**
+  * @brief  Active IM parameters set for the estimators calculation functions (reader
+  *	    side, call once per step and use the set until the next call).
+  * @param  ptIMparamsDb: pointer to user data structure with type "tIMparamsDb".
+  * @retval Pointer to the active IM parameters set.
+  */
+static inline tIMparams* tIMparamsDb_active(tIMparamsDb* ptIMparamsDb)
+{
+	tIMparams* ptActive = IM_LOAD_ACQ(ptIMparamsDb->ptActive);
+	
+	if(ptActive != ptIMparamsDb->ptUsed) IM_STORE_REL(ptIMparamsDb->ptUsed, ptActive);
+	return ptActive;
+}
+
+/**
+  * @brief  Stator voltage model of the rotor flux derivative (one of the Alpha/Beta
+  *	    components) without the leakage inductance term: the back-EMF in the
+  *	    Volts of the rotor side, fUs*f1divKr - fKrRs*fIs.
+  * @param  ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    fUs: stator voltage, Volts,
+  *	    fIs: stator current, A.
+  * @retval Back-EMF without the leakage term, Volts.
+  */
+static inline float imStatEmfR(const tIMparams* ptIMparams, float fUs, float fIs)
+{
+	return fUs*ptIMparams->f1divKr - ptIMparams->fKrRs*fIs;
+}
+
+/**
+  * @brief  Stator voltage model of the rotor flux derivative (one of the Alpha/Beta
+  *	    components): the stator back-EMF of "tIMstatObs_calc".
+  * @param  ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    fUs: stator voltage, Volts,
+  *	    fIs: stator current, A,
+  *	    fDiffIs: stator current increment over the step, A.
+  * @retval Stator back-EMF, Volts.
+  */
+static inline float imStatEmf(const tIMparams* ptIMparams, float fUs, float fIs,
+			      float fDiffIs)
+{
+	return imStatEmfR(ptIMparams, fUs, fIs) - ptIMparams->fKrSigLsDivDt*fDiffIs;
+}
+
+/**
+  * @brief  Current model of the rotor flux derivative (one of the Alpha/Beta
+  *	    components): the rotor back-EMF fLmDivTr*fIs - f1divTr*fFr - fWFrQ, where
+  *	    fWFrQ is fWrE*fFrBe for the Alpha and -fWrE*fFrAl for the Beta component.
+  * @param  ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    fIs: stator current, A,
+  *	    fFr: rotor flux, Wb,
+  *	    fWFrQ: rotation term of the quadrature flux component, Volts.
+  * @retval Rotor back-EMF, Volts.
+  */
+static inline float imRotEmf(const tIMparams* ptIMparams, float fIs, float fFr,
+			     float fWFrQ)
+{
+	return fIs*ptIMparams->fLmDivTr - fFr*ptIMparams->f1divTr - fWFrQ;
+}
+
 /* IM stator back-EMF observer function prototype **********************************/
-void tIMstatObs_calc(tIMstatObs*, tIMparams*);
+void tIMstatObs_calc(tIMstatObs*, const tIMparams* IM_RESTRICT);
+
+/* IM stator back-EMF observer with filtered derivative function prototype *********/
+void tIMstatObs_calcFilt(tIMstatObs*, const tIMparams* IM_RESTRICT);
 
 /* IM rotor back-EMF and flux observer function prototype **************************/
-void tIMrotObs_calc(tIMrotObs*, tIMparams*);
+void tIMrotObs_calc(tIMrotObs*, const tIMparams* IM_RESTRICT);
+
+/* IM rotor observer with exact (matrix exponential) discretization prototype ******/
+void tIMrotObs_calcExact(tIMrotObs*, const tIMparams* IM_RESTRICT);
+
+/* IM rotor model coefficients table build function prototype **********************/
+void tIMrotLut_init(tIMrotLut*, float);
+
+/* IM rotor observer with exact discretization and coefficients table prototype ****/
+void tIMrotObs_calcLut(tIMrotObs*, const tIMparams* IM_RESTRICT);
+
+/* IM rotor observer with prewarped bilinear discretization prototype **************/
+void tIMrotObs_calcBilin(tIMrotObs*, const tIMparams* IM_RESTRICT);
+
+/* IM rotor observer with 2nd order Runge-Kutta (Heun) integration prototype *******/
+void tIMrotObs_calcRK2(tIMrotObs*, const tIMparams* IM_RESTRICT);
+
+/* IM rotor speed and flux observer initialization function prototype **************/
+void tIMspeedObs_init(tIMspeedObs*, const tIMparams* IM_RESTRICT);
+
+/* IM rotor speed and flux observer state seeding function prototype *************/
+void tIMspeedObs_seed(tIMspeedObs*, const tIMparams* IM_RESTRICT, float, float, float);
 
 /* IM rotor speed and flux observer function prototype *****************************/
-void tIMspeedObs_calc(tIMspeedObs*, tIMparams*);
+void tIMspeedObs_calc(tIMspeedObs*, const tIMparams* IM_RESTRICT);
+
+/* IM rotor speed and flux observer with input binding function prototype *********/
+void tIMspeedObs_calcBound(tIMspeedObs*, const tIMparams* IM_RESTRICT);
+
+/* IM rotor speed and flux observer block (N samples) function prototype ***********/
+void tIMspeedObs_calcBlock(tIMspeedObs*, const tIMparams* IM_RESTRICT, const tIMblockIn*,
+			   const tIMblockOut*, unsigned);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,298 @@
+/**
+  ***********************************************************************************
+  * @file    im_estimators.hpp
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the header-only C++ (C++11 or later) front-end of
+  *	     the induction motor (IM) rotor speed and flux observer with the
+  *	     compile-time (constexpr) motor parameters and policies:
+  *		+ constexpr per-step coefficients of estimators;
+  *		+ PI-adapter policies (constexpr or run-time coefficients);
+  *		+ rotor flux angle and magnitude policies.
+  *	     The stator observer, rotor observer and PI-adapter are collapsed into
+  *	     one inlined function (no function pointers), the math and the order
+  *	     of floating point operations are the same as in "tIMspeedObs_calc".
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_ESTIMATORS_HPP__
+#define __IM_ESTIMATORS_HPP__
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators.h" // Induction Motor estimators library (C API)
+
+/* Exported macro -----------------------------------------------------------------*/
+
+/**
+  * @brief Forced inlining of the observer functions
+  */
+#if defined(__GNUC__) || defined(__clang__)
+#define IM_FORCE_INLINE		inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define IM_FORCE_INLINE		__forceinline
+#else
+#define IM_FORCE_INLINE		inline
+#endif
+
+namespace im {
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief Per-step coefficients of estimators calculated at compile time from the
+  *	   user motor parameters "Params" (same formulas as "tIMparams_init").
+  *	   "Params" is a user structure with the "static constexpr float" members:
+  *	   fDt, fNpP, fRs, fRr, fLs, fLr, fLm (same meaning as in "tIMparams").
+  */
+template<class Params>
+struct IMcoefs
+{
+	static constexpr float f1divTr = Params::fRr/Params::fLr;
+	static constexpr float f1divKr = Params::fLr/Params::fLm;
+	static constexpr float fSigLs = (1.0f - Params::fLm*Params::fLm/
+					(Params::fLs*Params::fLr)) * Params::fLs;
+	static constexpr float f1divDt = 1.0f/Params::fDt;
+	static constexpr float fHalfDt = 0.5f*Params::fDt;
+	static constexpr float fKrRs = Params::fRs*f1divKr;
+	static constexpr float fKrSigLsDivDt = fSigLs*f1divDt*f1divKr;
+	static constexpr float fLmDivTr = Params::fLm*f1divTr;
+};
+
+/**
+  * @brief Anti-windup settings of the "Gains" structure of "PIconst": the optional
+  *	   members "static constexpr unsigned uAwMode" and "static constexpr float
+  *	   fKaw" (both, same meaning as in "tPI"), PID_AW_NONE if not defined.
+  */
+template<class Gains, class = void>
+struct PIawConst
+{
+	static constexpr unsigned uAwMode = PID_AW_NONE;
+	static constexpr float fKaw = 0.0f;
+};
+
+template<class Gains>
+struct PIawConst<Gains, decltype(void(Gains::uAwMode))>
+{
+	static constexpr unsigned uAwMode = Gains::uAwMode;
+	static constexpr float fKaw = Gains::fKaw;
+};
+
+/**
+  * @brief PI-adapter policy with compile-time coefficients. "Gains" is a user
+  *	   structure with the "static constexpr float" members: fKp, fKi,
+  *	   fUpOutLim, fLowOutLim and optional anti-windup settings (see
+  *	   "PIawConst"), same meaning and math as in "tPI_calc".
+  */
+template<class Gains>
+class PIconst
+{
+	typedef PIawConst<Gains> Aw;
+
+public:
+	IM_FORCE_INLINE float calc(float fIn, float fHalfDt, float fDt)
+	{
+		const float fLowOutLim = Gains::fLowOutLim;
+		const float fUpOutLim = Gains::fUpOutLim;
+		const float fAwKdt = (Aw::uAwMode == PID_AW_BACKCALC) ? Aw::fKaw*fDt : 0.0f;
+		const float fAwClamp = (Aw::uAwMode == PID_AW_CLAMP) ? 1.0f : 0.0f;
+		float fPout = fIn*Gains::fKp;
+		float fIout = fIprevOut + fHalfDt*(fPout*Gains::fKi + fIprevIn);
+		float fPreOut, fOut;
+
+		fIprevIn = fPout;
+
+		fPreOut = fPout + fIout;
+		fOut = PID_SATF(fPreOut, fLowOutLim, fUpOutLim);
+
+		fIprevOut = tPID_aw(fIout, fIprevOut, fOut - fPreOut, fAwKdt, fAwClamp);
+		return fOut;
+	}
+
+	IM_FORCE_INLINE void rst()
+	{
+		fIprevIn = 0.0f;
+		fIprevOut = 0.0f;
+	}
+
+private:
+	float fIprevIn = 0.0f;			// Integral link's previous input
+	float fIprevOut = 0.0f;			// Integral link's previous output
+};
+
+/**
+  * @brief PI-adapter policy with run-time coefficients (can be tuned online), same
+  *	   math as in "tPI_calc"
+  */
+class PIvar
+{
+public:
+// Inputs:
+	float fKp = 0.0f;			// Proportional coefficient
+	float fKi = 0.0f;			// Integral coefficient
+	float fUpOutLim = 0.0f;			// Output upper limit
+	float fLowOutLim = 0.0f;		// Output lower limit
+	unsigned uAwMode = PID_AW_NONE;		// Anti-windup mode (PID_AW_...)
+	float fKaw = 0.0f;			// Back-calculation gain, 1/Sec
+
+	IM_FORCE_INLINE float calc(float fIn, float fHalfDt, float fDt)
+	{
+		const float fAwKdt = (uAwMode == PID_AW_BACKCALC) ? fKaw*fDt : 0.0f;
+		const float fAwClamp = (uAwMode == PID_AW_CLAMP) ? 1.0f : 0.0f;
+		float fPout = fIn*fKp;
+		float fIout = fIprevOut + fHalfDt*(fPout*fKi + fIprevIn);
+		float fPreOut, fOut;
+
+		fIprevIn = fPout;
+
+		fPreOut = fPout + fIout;
+		fOut = PID_SATF(fPreOut, fLowOutLim, fUpOutLim);
+
+		fIprevOut = tPID_aw(fIout, fIprevOut, fOut - fPreOut, fAwKdt, fAwClamp);
+		return fOut;
+	}
+
+	IM_FORCE_INLINE void rst()
+	{
+		fIprevIn = 0.0f;
+		fIprevOut = 0.0f;
+	}
+
+private:
+	float fIprevIn = 0.0f;			// Integral link's previous input
+	float fIprevOut = 0.0f;			// Integral link's previous output
+};
+
+/**
+  * @brief Rotor flux angle and magnitude policy: calculation with the accuracy
+  *	   selected by IM_FAST_MATH (see "im_fast_math.h")
+  */
+struct AnglePolar
+{
+	static IM_FORCE_INLINE void calc(float fFrBe, float fFrAl, float& fFrAng,
+					 float& fFrMagn)
+	{
+		imPolarf(fFrBe, fFrAl, &fFrAng, &fFrMagn);
+	}
+};
+
+/**
+  * @brief Rotor flux angle and magnitude policy: no calculation (fFrAng and fFrMagn
+  *	   are not updated, same as IM_SPEED_OBS_NO_FLUX_POLAR of the C API)
+  */
+struct AngleNone
+{
+	static IM_FORCE_INLINE void calc(float, float, float&, float&) {}
+};
+
+/**
+  * @brief IM sensorless rotor speed & flux observer with compile-time motor
+  *	   parameters (same math as "tIMspeedObs" with "sPI.fDtSec" = "fDt").
+  */
+template<class Params, class PiPolicy = PIvar, class AnglePolicy = AnglePolar>
+class SpeedObserver
+{
+	typedef IMcoefs<Params> K;
+
+public:
+// Internal variables:
+	PiPolicy	sPI;			// PI-adapter (run-time settings for PIvar)
+// Outputs:
+	float		fWrE = 0.0f;		// Rotor electrical speed, Rad/Sec
+	float		fFrAng = 0.0f;		// Rotor flux angle, Rad
+	float		fFrMagn = 0.0f;		// Rotor flux magnitude, Wb
+	float		fFrAl = 0.0f;		// Rotor flux Alpha, Wb
+	float		fFrBe = 0.0f;		// Rotor flux Beta, Wb
+
+	/**
+	  * @brief  IM rotor speed and flux observer calculation function.
+	  * @param  fUsAl, fUsBe: stator voltages Alpha and Beta, Volts,
+	  *	    fIsAl, fIsBe: stator currents Alpha and Beta, A.
+	  * @retval Rotor electrical speed, Rad/Sec.
+	  */
+	IM_FORCE_INLINE float calc(float fUsAl, float fUsBe, float fIsAl, float fIsBe)
+	{
+		float fDiffIsAl, fDiffIsBe, fEsAl, fEsBe, fErAl, fErBe;
+
+		// stator back-EMF observer
+		fDiffIsAl = fIsAl - fPrevIsAl;
+		fPrevIsAl = fIsAl;
+		fDiffIsBe = fIsBe - fPrevIsBe;
+		fPrevIsBe = fIsBe;
+
+		fEsAl = fUsAl*K::f1divKr - K::fKrRs*fIsAl - K::fKrSigLsDivDt*fDiffIsAl;
+		fEsBe = fUsBe*K::f1divKr - K::fKrRs*fIsBe - K::fKrSigLsDivDt*fDiffIsBe;
+
+		// rotor back-EMF and flux observer
+		fErAl = fIsAl*K::fLmDivTr - fFrAl*K::f1divTr - fWrE*fFrBe;
+		fFrAl = fFrAl + K::fHalfDt*(fErAl + fPrevErAl);
+		fPrevErAl = fErAl;
+
+		fErBe = fIsBe*K::fLmDivTr - fFrBe*K::f1divTr + fWrE*fFrAl;
+		fFrBe = fFrBe + K::fHalfDt*(fErBe + fPrevErBe);
+		fPrevErBe = fErBe;
+
+		// PI-adapter of rotor speed
+		fWrE = sPI.calc(fIsAl*(fEsBe - fErBe) - fIsBe*(fEsAl - fErAl), K::fHalfDt,
+				Params::fDt);
+
+		AnglePolicy::calc(fFrBe, fFrAl, fFrAng, fFrMagn);
+		return fWrE;
+	}
+
+	/**
+	  * @brief  Reset the internal variables and outputs of the observer.
+	  */
+	IM_FORCE_INLINE void rst()
+	{
+		sPI.rst();
+		fPrevIsAl = fPrevIsBe = 0.0f;
+		fPrevErAl = fPrevErBe = 0.0f;
+		fFrAl = fFrBe = 0.0f;
+		fWrE = fFrAng = fFrMagn = 0.0f;
+	}
+
+	/**
+	  * @brief  Rotor mechanical speed, Rad/Sec.
+	  */
+	IM_FORCE_INLINE float wrMech() const
+	{
+		return fWrE*(1.0f/Params::fNpP);
+	}
+
+private:
+	float		fPrevIsAl = 0.0f;	// Previous stator current Alpha, A
+	float		fPrevIsBe = 0.0f;	// Previous stator current Beta, A
+	float		fPrevErAl = 0.0f;	// Previous rotor back-EMF Alpha, Volts
+	float		fPrevErBe = 0.0f;	// Previous rotor back-EMF Beta, Volts
+};
+
+} /* namespace im */
+
+#endif /* __IM_ESTIMATORS_HPP__ */
+
+/*********************************** END OF FILE ***********************************/
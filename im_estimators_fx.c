@@ -0,0 +1,328 @@
+/**
+  ***********************************************************************************
+  * @file    im_estimators_fx.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware function for implementation the following
+  *	     types fixed point (Q31 and Q15) induction motor estimators:
+  *		+ sensored rotor flux (angle, magnitude) and back-EMF observer; 
+  *		+ sensorless stator back-EMF observer; 
+  *		+ sensorless rotor speed and flux (angle, magnitude) observer.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators_fx.h"
+#include "im_estimators.h" // float tIMparams_init() is reused by initialization
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the Q31 induction motor parameters (scaled coefficients).
+  * @param  ptIMparams: pointer to user data structure with type "tIMparamsQ31".
+  * @retval None
+  */
+void tIMparamsQ31_init(tIMparamsQ31* ptIMparams)
+{
+	float fIdivU = ptIMparams->fIbase/ptIMparams->fUbase;
+	tIMparams sIM = IM_PARAMS_DEFAULTS;
+
+	sIM.fDt = ptIMparams->fDt;
+	sIM.fNpP = ptIMparams->fNpP;
+	sIM.fRs = ptIMparams->fRs;
+	sIM.fRr = ptIMparams->fRr;
+	sIM.fLs = ptIMparams->fLs;
+	sIM.fLr = ptIMparams->fLr;
+	sIM.fLm = ptIMparams->fLm;
+	sIM.m_init(&sIM);
+
+	ptIMparams->sEsU = q31_coef(sIM.f1divKr);
+	ptIMparams->sEsI = q31_coef(sIM.fRs*sIM.f1divKr*fIdivU);
+	ptIMparams->sEsD = q31_coef(sIM.fSigLs/sIM.fDt*sIM.f1divKr*fIdivU);
+	ptIMparams->sErI = q31_coef(sIM.fLm*sIM.f1divTr*fIdivU);
+	ptIMparams->sErF = q31_coef(sIM.f1divTr*ptIMparams->fFbase/ptIMparams->fUbase);
+	ptIMparams->sErW = q31_coef(ptIMparams->fWbase*ptIMparams->fFbase/
+				     ptIMparams->fUbase);
+	ptIMparams->sFrE = q31_coef(0.5f*sIM.fDt*ptIMparams->fUbase/ptIMparams->fFbase);
+}
+
+/**
+  * @brief  Q31 IM stator back-EMF observer calculation function
+  * @param  ptIMstatObs: pointer to user data structure with type "tIMstatObsQ31",
+  *	    ptIMparams: pointer to user data structure with type "tIMparamsQ31".
+  * @retval None
+  */
+void tIMstatObsQ31_calc(tIMstatObsQ31* ptIMstatObs,
+			const tIMparamsQ31* IM_RESTRICT ptIMparams)
+{
+	int32_t qDiffIsAl, qDiffIsBe;
+	
+	qDiffIsAl = q31_sub(ptIMstatObs->qIsAl, ptIMstatObs->qPrevIsAl);
+			ptIMstatObs->qPrevIsAl = ptIMstatObs->qIsAl;
+	
+	qDiffIsBe = q31_sub(ptIMstatObs->qIsBe, ptIMstatObs->qPrevIsBe);
+			ptIMstatObs->qPrevIsBe = ptIMstatObs->qIsBe;
+	
+	ptIMstatObs->qEsAl = q31_sub(q31_sub(q31_mulk(ptIMstatObs->qUsAl, ptIMparams->sEsU),
+				q31_mulk(ptIMstatObs->qIsAl, ptIMparams->sEsI)),
+				q31_mulk(qDiffIsAl, ptIMparams->sEsD));
+	
+	ptIMstatObs->qEsBe = q31_sub(q31_sub(q31_mulk(ptIMstatObs->qUsBe, ptIMparams->sEsU),
+				q31_mulk(ptIMstatObs->qIsBe, ptIMparams->sEsI)),
+				q31_mulk(qDiffIsBe, ptIMparams->sEsD));
+}
+
+/**
+  * @brief  Q31 IM rotor back-EMF and flux observer calculation function
+  * @param  ptIMrotObs: pointer to user data structure with type "tIMrotObsQ31",
+  *	    ptIMparams: pointer to user data structure with type "tIMparamsQ31".
+  * @retval None
+  */
+void tIMrotObsQ31_calc(tIMrotObsQ31* ptIMrotObs,
+		       const tIMparamsQ31* IM_RESTRICT ptIMparams)
+{
+	ptIMrotObs->qErAl = q31_sub(q31_sub(q31_mulk(ptIMrotObs->qIsAl, ptIMparams->sErI),
+				q31_mulk(ptIMrotObs->qFrAl, ptIMparams->sErF)),
+				q31_mulk(q31_mul(ptIMrotObs->qWrE, ptIMrotObs->qFrBe),
+				ptIMparams->sErW));
+	
+	ptIMrotObs->qPrevFrAl = q31_add(ptIMrotObs->qPrevFrAl, q31_add(
+				q31_mulk(ptIMrotObs->qErAl, ptIMparams->sFrE),
+				q31_mulk(ptIMrotObs->qPrevErAl, ptIMparams->sFrE)));
+	ptIMrotObs->qPrevErAl = ptIMrotObs->qErAl;
+	ptIMrotObs->qFrAl = ptIMrotObs->qPrevFrAl;
+						
+	ptIMrotObs->qErBe = q31_add(q31_sub(q31_mulk(ptIMrotObs->qIsBe, ptIMparams->sErI),
+				q31_mulk(ptIMrotObs->qFrBe, ptIMparams->sErF)),
+				q31_mulk(q31_mul(ptIMrotObs->qWrE, ptIMrotObs->qFrAl),
+				ptIMparams->sErW));
+
+	ptIMrotObs->qPrevFrBe = q31_add(ptIMrotObs->qPrevFrBe, q31_add(
+				q31_mulk(ptIMrotObs->qErBe, ptIMparams->sFrE),
+				q31_mulk(ptIMrotObs->qPrevErBe, ptIMparams->sFrE)));
+	ptIMrotObs->qPrevErBe = ptIMrotObs->qErBe;
+	ptIMrotObs->qFrBe = ptIMrotObs->qPrevFrBe;
+}
+
+/**
+  * @brief  Initialize the Q31 IM rotor speed and flux observer: set the base values
+  *	    of PI-adapter (input - fIbase*fUbase, output - fWbase) and initialize it.
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObsQ31",
+  *	    ptIMparams: pointer to initialized user data structure with type
+  *	    "tIMparamsQ31".
+  * @retval None
+  */
+void tIMspeedObsQ31_init(tIMspeedObsQ31* ptIMspeedObs,
+			 const tIMparamsQ31* IM_RESTRICT ptIMparams)
+{
+	ptIMspeedObs->sPI.fInBase = ptIMparams->fIbase*ptIMparams->fUbase;
+	ptIMspeedObs->sPI.fOutBase = ptIMparams->fWbase;
+	ptIMspeedObs->sPI.m_init(&ptIMspeedObs->sPI);
+}
+
+/**
+  * @brief  Q31 IM rotor speed and flux observer calculation function
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObsQ31",
+  *	    ptIMparams: pointer to user data structure with type "tIMparamsQ31".
+  * @retval None
+  */
+void tIMspeedObsQ31_calc(tIMspeedObsQ31* ptIMspeedObs,
+			 const tIMparamsQ31* IM_RESTRICT ptIMparams)
+{
+	ptIMspeedObs->sIMstatObs.qUsAl = ptIMspeedObs->qUsAl;
+	ptIMspeedObs->sIMstatObs.qUsBe = ptIMspeedObs->qUsBe;
+	ptIMspeedObs->sIMstatObs.qIsAl = ptIMspeedObs->qIsAl;
+	ptIMspeedObs->sIMstatObs.qIsBe = ptIMspeedObs->qIsBe;
+	
+	ptIMspeedObs->sIMrotObs.qIsAl = ptIMspeedObs->qIsAl;
+	ptIMspeedObs->sIMrotObs.qIsBe = ptIMspeedObs->qIsBe;
+	ptIMspeedObs->sIMrotObs.qWrE = ptIMspeedObs->qWrE;
+	
+	ptIMspeedObs->sIMstatObs.m_calc(&ptIMspeedObs->sIMstatObs, ptIMparams);
+	ptIMspeedObs->sIMrotObs.m_calc(&ptIMspeedObs->sIMrotObs, ptIMparams);
+	
+	ptIMspeedObs->sPI.qIn = q31_sub(q31_mul(ptIMspeedObs->qIsAl, q31_sub(
+				ptIMspeedObs->sIMstatObs.qEsBe, ptIMspeedObs->sIMrotObs.qErBe)),
+				q31_mul(ptIMspeedObs->qIsBe, q31_sub(
+				ptIMspeedObs->sIMstatObs.qEsAl, ptIMspeedObs->sIMrotObs.qErAl)));
+	
+	ptIMspeedObs->sPI.m_calc(&ptIMspeedObs->sPI);
+	
+	ptIMspeedObs->qWrE = ptIMspeedObs->sPI.qOut;
+	
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+	q31_polar(ptIMspeedObs->sIMrotObs.qFrBe, ptIMspeedObs->sIMrotObs.qFrAl,
+		  &ptIMspeedObs->qFrAng, &ptIMspeedObs->qFrMagn);
+#endif
+}
+
+/**
+  * @brief  Initialize the Q15 induction motor parameters (scaled coefficients).
+  * @param  ptIMparams: pointer to user data structure with type "tIMparamsQ15".
+  * @retval None
+  */
+void tIMparamsQ15_init(tIMparamsQ15* ptIMparams)
+{
+	float fIdivU = ptIMparams->fIbase/ptIMparams->fUbase;
+	tIMparams sIM = IM_PARAMS_DEFAULTS;
+
+	sIM.fDt = ptIMparams->fDt;
+	sIM.fNpP = ptIMparams->fNpP;
+	sIM.fRs = ptIMparams->fRs;
+	sIM.fRr = ptIMparams->fRr;
+	sIM.fLs = ptIMparams->fLs;
+	sIM.fLr = ptIMparams->fLr;
+	sIM.fLm = ptIMparams->fLm;
+	sIM.m_init(&sIM);
+
+	ptIMparams->sEsU = q15_coef(sIM.f1divKr);
+	ptIMparams->sEsI = q15_coef(sIM.fRs*sIM.f1divKr*fIdivU);
+	ptIMparams->sEsD = q15_coef(sIM.fSigLs/sIM.fDt*sIM.f1divKr*fIdivU);
+	ptIMparams->sErI = q15_coef(sIM.fLm*sIM.f1divTr*fIdivU);
+	ptIMparams->sErF = q15_coef(sIM.f1divTr*ptIMparams->fFbase/ptIMparams->fUbase);
+	ptIMparams->sErW = q15_coef(ptIMparams->fWbase*ptIMparams->fFbase/
+				     ptIMparams->fUbase);
+	ptIMparams->sFrE = q15_coef(0.5f*sIM.fDt*ptIMparams->fUbase/ptIMparams->fFbase);
+}
+
+/**
+  * @brief  Q15 IM stator back-EMF observer calculation function
+  * @param  ptIMstatObs: pointer to user data structure with type "tIMstatObsQ15",
+  *	    ptIMparams: pointer to user data structure with type "tIMparamsQ15".
+  * @retval None
+  */
+void tIMstatObsQ15_calc(tIMstatObsQ15* ptIMstatObs,
+			const tIMparamsQ15* IM_RESTRICT ptIMparams)
+{
+	int16_t qDiffIsAl, qDiffIsBe;
+	
+	qDiffIsAl = q15_sub(ptIMstatObs->qIsAl, ptIMstatObs->qPrevIsAl);
+			ptIMstatObs->qPrevIsAl = ptIMstatObs->qIsAl;
+	
+	qDiffIsBe = q15_sub(ptIMstatObs->qIsBe, ptIMstatObs->qPrevIsBe);
+			ptIMstatObs->qPrevIsBe = ptIMstatObs->qIsBe;
+	
+	ptIMstatObs->qEsAl = q15_sub(q15_sub(q15_mulk(ptIMstatObs->qUsAl, ptIMparams->sEsU),
+				q15_mulk(ptIMstatObs->qIsAl, ptIMparams->sEsI)),
+				q15_mulk(qDiffIsAl, ptIMparams->sEsD));
+	
+	ptIMstatObs->qEsBe = q15_sub(q15_sub(q15_mulk(ptIMstatObs->qUsBe, ptIMparams->sEsU),
+				q15_mulk(ptIMstatObs->qIsBe, ptIMparams->sEsI)),
+				q15_mulk(qDiffIsBe, ptIMparams->sEsD));
+}
+
+/**
+  * @brief  Q15 IM rotor back-EMF and flux observer calculation function
+  * @param  ptIMrotObs: pointer to user data structure with type "tIMrotObsQ15",
+  *	    ptIMparams: pointer to user data structure with type "tIMparamsQ15".
+  * @retval None
+  */
+void tIMrotObsQ15_calc(tIMrotObsQ15* ptIMrotObs,
+		       const tIMparamsQ15* IM_RESTRICT ptIMparams)
+{
+	ptIMrotObs->qErAl = q15_sub(q15_sub(q15_mulk(ptIMrotObs->qIsAl, ptIMparams->sErI),
+				q15_mulk(ptIMrotObs->qFrAl, ptIMparams->sErF)),
+				q15_mulk(q15_mul(ptIMrotObs->qWrE, ptIMrotObs->qFrBe),
+				ptIMparams->sErW));
+	
+	ptIMrotObs->qPrevFrAl = q31_add(ptIMrotObs->qPrevFrAl, q31_add(
+				q15_mulk31(ptIMrotObs->qErAl, ptIMparams->sFrE),
+				q15_mulk31(ptIMrotObs->qPrevErAl, ptIMparams->sFrE)));
+	ptIMrotObs->qPrevErAl = ptIMrotObs->qErAl;
+	ptIMrotObs->qFrAl = q31_to_q15(ptIMrotObs->qPrevFrAl);
+						
+	ptIMrotObs->qErBe = q15_add(q15_sub(q15_mulk(ptIMrotObs->qIsBe, ptIMparams->sErI),
+				q15_mulk(ptIMrotObs->qFrBe, ptIMparams->sErF)),
+				q15_mulk(q15_mul(ptIMrotObs->qWrE, ptIMrotObs->qFrAl),
+				ptIMparams->sErW));
+
+	ptIMrotObs->qPrevFrBe = q31_add(ptIMrotObs->qPrevFrBe, q31_add(
+				q15_mulk31(ptIMrotObs->qErBe, ptIMparams->sFrE),
+				q15_mulk31(ptIMrotObs->qPrevErBe, ptIMparams->sFrE)));
+	ptIMrotObs->qPrevErBe = ptIMrotObs->qErBe;
+	ptIMrotObs->qFrBe = q31_to_q15(ptIMrotObs->qPrevFrBe);
+}
+
+/**
+  * @brief  Initialize the Q15 IM rotor speed and flux observer: set the base values
+  *	    of PI-adapter (input - fIbase*fUbase, output - fWbase) and initialize it.
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObsQ15",
+  *	    ptIMparams: pointer to initialized user data structure with type
+  *	    "tIMparamsQ15".
+  * @retval None
+  */
+void tIMspeedObsQ15_init(tIMspeedObsQ15* ptIMspeedObs,
+			 const tIMparamsQ15* IM_RESTRICT ptIMparams)
+{
+	ptIMspeedObs->sPI.fInBase = ptIMparams->fIbase*ptIMparams->fUbase;
+	ptIMspeedObs->sPI.fOutBase = ptIMparams->fWbase;
+	ptIMspeedObs->sPI.m_init(&ptIMspeedObs->sPI);
+}
+
+/**
+  * @brief  Q15 IM rotor speed and flux observer calculation function
+  * @param  ptIMspeedObs: pointer to user data structure with type "tIMspeedObsQ15",
+  *	    ptIMparams: pointer to user data structure with type "tIMparamsQ15".
+  * @retval None
+  */
+void tIMspeedObsQ15_calc(tIMspeedObsQ15* ptIMspeedObs,
+			 const tIMparamsQ15* IM_RESTRICT ptIMparams)
+{
+	ptIMspeedObs->sIMstatObs.qUsAl = ptIMspeedObs->qUsAl;
+	ptIMspeedObs->sIMstatObs.qUsBe = ptIMspeedObs->qUsBe;
+	ptIMspeedObs->sIMstatObs.qIsAl = ptIMspeedObs->qIsAl;
+	ptIMspeedObs->sIMstatObs.qIsBe = ptIMspeedObs->qIsBe;
+	
+	ptIMspeedObs->sIMrotObs.qIsAl = ptIMspeedObs->qIsAl;
+	ptIMspeedObs->sIMrotObs.qIsBe = ptIMspeedObs->qIsBe;
+	ptIMspeedObs->sIMrotObs.qWrE = ptIMspeedObs->qWrE;
+	
+	ptIMspeedObs->sIMstatObs.m_calc(&ptIMspeedObs->sIMstatObs, ptIMparams);
+	ptIMspeedObs->sIMrotObs.m_calc(&ptIMspeedObs->sIMrotObs, ptIMparams);
+	
+	ptIMspeedObs->sPI.qIn = q15_sub(q15_mul(ptIMspeedObs->qIsAl, q15_sub(
+				ptIMspeedObs->sIMstatObs.qEsBe, ptIMspeedObs->sIMrotObs.qErBe)),
+				q15_mul(ptIMspeedObs->qIsBe, q15_sub(
+				ptIMspeedObs->sIMstatObs.qEsAl, ptIMspeedObs->sIMrotObs.qErAl)));
+	
+	ptIMspeedObs->sPI.m_calc(&ptIMspeedObs->sPI);
+	
+	ptIMspeedObs->qWrE = ptIMspeedObs->sPI.qOut;
+	
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+	q15_polar(ptIMspeedObs->sIMrotObs.qFrBe, ptIMspeedObs->sIMrotObs.qFrAl,
+		  &ptIMspeedObs->qFrAng, &ptIMspeedObs->qFrMagn);
+#endif
+}
+
+/*********************************** END OF FILE ***********************************/
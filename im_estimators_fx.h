@@ -0,0 +1,473 @@
+/**
+  ***********************************************************************************
+  * @file    im_estimators_fx.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the fixed point (Q31 and Q15) induction
+  *	     motor (IM) rotor flux and speed estimators.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_ESTIMATORS_FX_H__
+#define __IM_ESTIMATORS_FX_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "fx_pid.h" // Fixed point P/I/D-controllers library
+#include "fx_math.h" // Fixed point math library
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Qualifier of the IM parameters pointer of the estimators functions: the
+  *	   parameters are read only and not aliased by the estimator state during
+  *	   the call (one parameters set may be shared by many estimators).
+  */
+#ifndef IM_RESTRICT
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L) && !defined(__cplusplus)
+#define IM_RESTRICT		restrict
+#elif defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#define IM_RESTRICT		__restrict
+#else
+#define IM_RESTRICT
+#endif
+#endif
+
+/* Exported types -----------------------------------------------------------------*/
+
+/*
+ * All Q31/Q15 values are the per-unit values of the base values set in IM
+ * parameters (currents - fIbase, voltages and back-EMFs - fUbase, rotor speed -
+ * fWbase, rotor flux - fFbase). The motor parameters are converted to the scaled
+ * fixed point coefficients by m_init function, so the float arithmetic is used
+ * only at initialization time. The rotor flux integrators keep the Q31 resolution
+ * for both Q31 and Q15 observers.
+ */
+
+/** 
+  * @brief "Fixed point Q31 IM parameters Module" data structure
+  */
+typedef struct sIMparamsQ31
+{
+// Inputs (used by m_init function only):
+	float fDt;				// Discretization time, Sec
+	float fNpP;				// Count of pole pairs
+	float fRs;				// Stator resistance, Ohm
+	float fRr;				// Rotor resistance, Ohm
+	float fLs;				// Stator inductance, H
+	float fLr;				// Rotor inductance, H
+	float fLm;				// Magnetizing inductance, H
+	float fIbase;				// Base value of currents, A
+	float fUbase;				// Base value of voltages, Volts
+	float fWbase;				// Base value of rotor electrical
+						// speed, Rad/Sec
+	float fFbase;				// Base value of rotor flux, Wb
+// Internal variables:
+	tQ31coef sEsU;				// fLr/fLm
+	tQ31coef sEsI;				// fRs*fLr/fLm*fIbase/fUbase
+	tQ31coef sEsD;				// fSigLs/fDt*fLr/fLm*fIbase/fUbase
+	tQ31coef sErI;				// fLm/Tr*fIbase/fUbase
+	tQ31coef sErF;				// 1/Tr*fFbase/fUbase
+	tQ31coef sErW;				// fWbase*fFbase/fUbase
+	tQ31coef sFrE;				// 0.5*fDt*fUbase/fFbase
+// Functions:
+	void  (*m_init)(struct sIMparamsQ31*);	// Pointer to Init() function
+} tIMparamsQ31;
+
+/** 
+  * @brief "Fixed point Q31 IM sensorless stator back-EMF observer Module" data
+  *	   structure
+  */
+typedef struct sIMstatObsQ31
+{
+// Inputs:
+	int32_t		qIsAl;			// Stator current Alpha, Q31
+	int32_t		qIsBe;			// Stator current Beta, Q31
+	int32_t		qUsAl;			// Stator voltage Alpha, Q31
+	int32_t		qUsBe;			// Stator voltage Beta, Q31
+// Internal variables:
+	int32_t		qPrevIsAl;		// Previous value of stator current
+						// Alpha, Q31
+	int32_t		qPrevIsBe;		// Previous value of stator current
+						// Beta, Q31
+// Outputs:
+	int32_t		qEsAl;			// Stator back-EMF Alpha, Q31
+	int32_t		qEsBe;			// Stator back-EMF Beta, Q31
+// Functions:
+	void	(*m_calc)(struct sIMstatObsQ31*,	// Pointer to estimator function
+				const tIMparamsQ31* IM_RESTRICT);
+} tIMstatObsQ31;
+
+/** 
+  * @brief "Fixed point Q31 IM sensored rotor flux & back-EMF observer Module"
+  *	   data structure
+  */
+typedef struct sIMrotObsQ31
+{
+// Inputs:
+	int32_t		qIsAl;			// Stator current Alpha, Q31
+	int32_t		qIsBe;			// Stator current Beta, Q31
+	int32_t		qWrE;			// Rotor electrical speed, Q31
+// Internal variables:
+	int32_t		qPrevErAl;		// Previous value of rotor back-EMF
+						// Alpha, Q31
+	int32_t		qPrevErBe;		// Previous value of rotor back-EMF
+						// Beta, Q31
+	int32_t		qPrevFrAl;		// Previous value of rotor flux
+						// Alpha, Q31
+	int32_t		qPrevFrBe;		// Previous value of rotor flux
+						// Beta, Q31
+// Outputs:
+	int32_t		qFrAl;			// Rotor flux Alpha, Q31
+	int32_t		qFrBe;			// Rotor flux Beta, Q31
+	int32_t		qErAl;			// Rotor back-EMF Alpha, Q31
+	int32_t		qErBe;			// Rotor back-EMF Beta, Q31
+// Functions:
+	void	(*m_calc)(struct sIMrotObsQ31*,	// Pointer to estimator function
+				const tIMparamsQ31* IM_RESTRICT);
+} tIMrotObsQ31;
+
+/** 
+  * @brief "Fixed point Q31 IM sensorless rotor speed & flux observer Module" data
+  *	   structure
+  */
+typedef struct sIMspeedObsQ31
+{
+// Inputs:
+	int32_t		qUsAl;			// Stator voltage Alpha, Q31
+	int32_t		qUsBe;			// Stator voltage Beta, Q31
+	int32_t		qIsAl;			// Stator current Alpha, Q31
+	int32_t		qIsBe;			// Stator current Beta, Q31
+// Internal variables:
+	tIMstatObsQ31	sIMstatObs;		// Stator observer data structure
+	tIMrotObsQ31	sIMrotObs;		// Rotor observer data structure
+	tPIq31		sPI;			// PI-controller data structure
+// Outputs:
+	int32_t		qWrE;			// Rotor electrical speed, Q31
+	int32_t		qFrAng;			// Rotor flux angle, Q31 (1.0 = PI Rad)
+	int32_t		qFrMagn;		// Rotor flux magnitude, Q31
+// Functions:
+	void	(*m_init)(struct sIMspeedObsQ31*,	// Pointer to initialization
+				const tIMparamsQ31* IM_RESTRICT);	// function
+	void	(*m_calc)(struct sIMspeedObsQ31*,	// Pointer to estimator function
+				const tIMparamsQ31* IM_RESTRICT);
+} tIMspeedObsQ31;
+
+/** 
+  * @brief "Fixed point Q15 IM parameters Module" data structure
+  */
+typedef struct sIMparamsQ15
+{
+// Inputs (used by m_init function only):
+	float fDt;				// Discretization time, Sec
+	float fNpP;				// Count of pole pairs
+	float fRs;				// Stator resistance, Ohm
+	float fRr;				// Rotor resistance, Ohm
+	float fLs;				// Stator inductance, H
+	float fLr;				// Rotor inductance, H
+	float fLm;				// Magnetizing inductance, H
+	float fIbase;				// Base value of currents, A
+	float fUbase;				// Base value of voltages, Volts
+	float fWbase;				// Base value of rotor electrical
+						// speed, Rad/Sec
+	float fFbase;				// Base value of rotor flux, Wb
+// Internal variables:
+	tQ15coef sEsU;				// fLr/fLm
+	tQ15coef sEsI;				// fRs*fLr/fLm*fIbase/fUbase
+	tQ15coef sEsD;				// fSigLs/fDt*fLr/fLm*fIbase/fUbase
+	tQ15coef sErI;				// fLm/Tr*fIbase/fUbase
+	tQ15coef sErF;				// 1/Tr*fFbase/fUbase
+	tQ15coef sErW;				// fWbase*fFbase/fUbase
+	tQ15coef sFrE;				// 0.5*fDt*fUbase/fFbase
+// Functions:
+	void  (*m_init)(struct sIMparamsQ15*);	// Pointer to Init() function
+} tIMparamsQ15;
+
+/** 
+  * @brief "Fixed point Q15 IM sensorless stator back-EMF observer Module" data
+  *	   structure
+  */
+typedef struct sIMstatObsQ15
+{
+// Inputs:
+	int16_t		qIsAl;			// Stator current Alpha, Q15
+	int16_t		qIsBe;			// Stator current Beta, Q15
+	int16_t		qUsAl;			// Stator voltage Alpha, Q15
+	int16_t		qUsBe;			// Stator voltage Beta, Q15
+// Internal variables:
+	int16_t		qPrevIsAl;		// Previous value of stator current
+						// Alpha, Q15
+	int16_t		qPrevIsBe;		// Previous value of stator current
+						// Beta, Q15
+// Outputs:
+	int16_t		qEsAl;			// Stator back-EMF Alpha, Q15
+	int16_t		qEsBe;			// Stator back-EMF Beta, Q15
+// Functions:
+	void	(*m_calc)(struct sIMstatObsQ15*,	// Pointer to estimator function
+				const tIMparamsQ15* IM_RESTRICT);
+} tIMstatObsQ15;
+
+/** 
+  * @brief "Fixed point Q15 IM sensored rotor flux & back-EMF observer Module"
+  *	   data structure
+  */
+typedef struct sIMrotObsQ15
+{
+// Inputs:
+	int16_t		qIsAl;			// Stator current Alpha, Q15
+	int16_t		qIsBe;			// Stator current Beta, Q15
+	int16_t		qWrE;			// Rotor electrical speed, Q15
+// Internal variables:
+	int16_t		qPrevErAl;		// Previous value of rotor back-EMF
+						// Alpha, Q15
+	int16_t		qPrevErBe;		// Previous value of rotor back-EMF
+						// Beta, Q15
+	int32_t		qPrevFrAl;		// Previous value of rotor flux
+						// Alpha, Q31
+	int32_t		qPrevFrBe;		// Previous value of rotor flux
+						// Beta, Q31
+// Outputs:
+	int16_t		qFrAl;			// Rotor flux Alpha, Q15
+	int16_t		qFrBe;			// Rotor flux Beta, Q15
+	int16_t		qErAl;			// Rotor back-EMF Alpha, Q15
+	int16_t		qErBe;			// Rotor back-EMF Beta, Q15
+// Functions:
+	void	(*m_calc)(struct sIMrotObsQ15*,	// Pointer to estimator function
+				const tIMparamsQ15* IM_RESTRICT);
+} tIMrotObsQ15;
+
+/** 
+  * @brief "Fixed point Q15 IM sensorless rotor speed & flux observer Module" data
+  *	   structure
+  */
+typedef struct sIMspeedObsQ15
+{
+// Inputs:
+	int16_t		qUsAl;			// Stator voltage Alpha, Q15
+	int16_t		qUsBe;			// Stator voltage Beta, Q15
+	int16_t		qIsAl;			// Stator current Alpha, Q15
+	int16_t		qIsBe;			// Stator current Beta, Q15
+// Internal variables:
+	tIMstatObsQ15	sIMstatObs;		// Stator observer data structure
+	tIMrotObsQ15	sIMrotObs;		// Rotor observer data structure
+	tPIq15		sPI;			// PI-controller data structure
+// Outputs:
+	int16_t		qWrE;			// Rotor electrical speed, Q15
+	int16_t		qFrAng;			// Rotor flux angle, Q15 (1.0 = PI Rad)
+	int16_t		qFrMagn;		// Rotor flux magnitude, Q15
+// Functions:
+	void	(*m_init)(struct sIMspeedObsQ15*,	// Pointer to initialization
+				const tIMparamsQ15* IM_RESTRICT);	// function
+	void	(*m_calc)(struct sIMspeedObsQ15*,	// Pointer to estimator function
+				const tIMparamsQ15* IM_RESTRICT);
+} tIMspeedObsQ15;
+
+/* Exported constants -------------------------------------------------------------*/
+
+/** 
+  * @brief Initialization constant with defaults for "tIMparamsQ31" user variables
+  */
+#define IM_PARAMS_Q31_DEFAULTS {		\
+	.fDt		= 1.0f,			\
+	.fNpP		= 0.0f,			\
+	.fRs		= 0.0f,			\
+	.fRr		= 0.0f,			\
+	.fLs		= 0.0f,			\
+	.fLr		= 0.0f,			\
+	.fLm		= 0.0f,			\
+	.fIbase		= 1.0f,			\
+	.fUbase		= 1.0f,			\
+	.fWbase		= 1.0f,			\
+	.fFbase		= 1.0f,			\
+	.m_init		= tIMparamsQ31_init	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for "tIMstatObsQ31" user variables
+  */
+#define IM_STAT_OBS_Q31_DEFAULTS {		\
+	.qIsAl		= 0,			\
+	.qIsBe		= 0,			\
+	.qUsAl		= 0,			\
+	.qUsBe		= 0,			\
+	.qPrevIsAl	= 0,			\
+	.qPrevIsBe	= 0,			\
+	.qEsAl		= 0,			\
+	.qEsBe		= 0,			\
+	.m_calc		= tIMstatObsQ31_calc	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for "tIMrotObsQ31" user variables
+  */
+#define IM_ROT_OBS_Q31_DEFAULTS {		\
+	.qIsAl		= 0,			\
+	.qIsBe		= 0,			\
+	.qWrE		= 0,			\
+	.qPrevErAl	= 0,			\
+	.qPrevErBe	= 0,			\
+	.qPrevFrAl	= 0,			\
+	.qPrevFrBe	= 0,			\
+	.qFrAl		= 0,			\
+	.qFrBe		= 0,			\
+	.qErAl		= 0,			\
+	.qErBe		= 0,			\
+	.m_calc		= tIMrotObsQ31_calc	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for "tIMspeedObsQ31" user variables
+  */
+#define IM_SPEED_OBS_Q31_DEFAULTS {		\
+	.qUsAl		= 0,			\
+	.qUsBe		= 0,			\
+	.qIsAl		= 0,			\
+	.qIsBe		= 0,			\
+	.sIMstatObs	= IM_STAT_OBS_Q31_DEFAULTS,	\
+	.sIMrotObs	= IM_ROT_OBS_Q31_DEFAULTS,	\
+	.sPI		= PI_Q31_DEFAULTS,	\
+	.qWrE		= 0,			\
+	.qFrAng		= 0,			\
+	.qFrMagn	= 0,			\
+	.m_init		= tIMspeedObsQ31_init,	\
+	.m_calc		= tIMspeedObsQ31_calc	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for "tIMparamsQ15" user variables
+  */
+#define IM_PARAMS_Q15_DEFAULTS {		\
+	.fDt		= 1.0f,			\
+	.fNpP		= 0.0f,			\
+	.fRs		= 0.0f,			\
+	.fRr		= 0.0f,			\
+	.fLs		= 0.0f,			\
+	.fLr		= 0.0f,			\
+	.fLm		= 0.0f,			\
+	.fIbase		= 1.0f,			\
+	.fUbase		= 1.0f,			\
+	.fWbase		= 1.0f,			\
+	.fFbase		= 1.0f,			\
+	.m_init		= tIMparamsQ15_init	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for "tIMstatObsQ15" user variables
+  */
+#define IM_STAT_OBS_Q15_DEFAULTS {		\
+	.qIsAl		= 0,			\
+	.qIsBe		= 0,			\
+	.qUsAl		= 0,			\
+	.qUsBe		= 0,			\
+	.qPrevIsAl	= 0,			\
+	.qPrevIsBe	= 0,			\
+	.qEsAl		= 0,			\
+	.qEsBe		= 0,			\
+	.m_calc		= tIMstatObsQ15_calc	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for "tIMrotObsQ15" user variables
+  */
+#define IM_ROT_OBS_Q15_DEFAULTS {		\
+	.qIsAl		= 0,			\
+	.qIsBe		= 0,			\
+	.qWrE		= 0,			\
+	.qPrevErAl	= 0,			\
+	.qPrevErBe	= 0,			\
+	.qPrevFrAl	= 0,			\
+	.qPrevFrBe	= 0,			\
+	.qFrAl		= 0,			\
+	.qFrBe		= 0,			\
+	.qErAl		= 0,			\
+	.qErBe		= 0,			\
+	.m_calc		= tIMrotObsQ15_calc	\
+}
+
+/** 
+  * @brief Initialization constant with defaults for "tIMspeedObsQ15" user variables
+  */
+#define IM_SPEED_OBS_Q15_DEFAULTS {		\
+	.qUsAl		= 0,			\
+	.qUsBe		= 0,			\
+	.qIsAl		= 0,			\
+	.qIsBe		= 0,			\
+	.sIMstatObs	= IM_STAT_OBS_Q15_DEFAULTS,	\
+	.sIMrotObs	= IM_ROT_OBS_Q15_DEFAULTS,	\
+	.sPI		= PI_Q15_DEFAULTS,	\
+	.qWrE		= 0,			\
+	.qFrAng		= 0,			\
+	.qFrMagn	= 0,			\
+	.m_init		= tIMspeedObsQ15_init,	\
+	.m_calc		= tIMspeedObsQ15_calc	\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* Q31 IM parameters initialization function prototype *****************************/
+void tIMparamsQ31_init(tIMparamsQ31*);
+
+/* Q31 IM stator back-EMF observer function prototype ******************************/
+void tIMstatObsQ31_calc(tIMstatObsQ31*, const tIMparamsQ31* IM_RESTRICT);
+
+/* Q31 IM rotor back-EMF and flux observer function prototype **********************/
+void tIMrotObsQ31_calc(tIMrotObsQ31*, const tIMparamsQ31* IM_RESTRICT);
+
+/* Q31 IM rotor speed and flux observer initialization function prototype **********/
+void tIMspeedObsQ31_init(tIMspeedObsQ31*, const tIMparamsQ31* IM_RESTRICT);
+
+/* Q31 IM rotor speed and flux observer function prototype *************************/
+void tIMspeedObsQ31_calc(tIMspeedObsQ31*, const tIMparamsQ31* IM_RESTRICT);
+
+/* Q15 IM parameters initialization function prototype *****************************/
+void tIMparamsQ15_init(tIMparamsQ15*);
+
+/* Q15 IM stator back-EMF observer function prototype ******************************/
+void tIMstatObsQ15_calc(tIMstatObsQ15*, const tIMparamsQ15* IM_RESTRICT);
+
+/* Q15 IM rotor back-EMF and flux observer function prototype **********************/
+void tIMrotObsQ15_calc(tIMrotObsQ15*, const tIMparamsQ15* IM_RESTRICT);
+
+/* Q15 IM rotor speed and flux observer initialization function prototype **********/
+void tIMspeedObsQ15_init(tIMspeedObsQ15*, const tIMparamsQ15* IM_RESTRICT);
+
+/* Q15 IM rotor speed and flux observer function prototype *************************/
+void tIMspeedObsQ15_calc(tIMspeedObsQ15*, const tIMparamsQ15* IM_RESTRICT);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_ESTIMATORS_FX_H__ */
+
+/*********************************** END OF FILE ***********************************/
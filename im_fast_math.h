@@ -0,0 +1,238 @@
+/**
+  ***********************************************************************************
+  * @file    im_fast_math.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the inline functions for the fast calculation of
+  *	     the vector angle and magnitude (atan2 and hypot replacement) used by
+  *	     the induction motor (IM) estimators.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_FAST_MATH_H__
+#define __IM_FAST_MATH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Accuracy level of the vector angle and magnitude calculation, can be
+  *	   overridden by the user at compile time:
+  *	   0 - "atan2f" and "hypotf" of the standard C library (default);
+  *	   1 - polynomial atan2 (max error 1.2e-5 Rad) and "sqrtf(x*x + y*y)"
+  *	       magnitude (max relative error 2 ulp, no overflow protection);
+  *	   2 - fused angle and magnitude with one division and no square root:
+  *	       polynomial atan2 (max error 1.2e-5 Rad) and polynomial magnitude
+  *	       (max relative error 1.3e-4, i.e. 0.13 mWb for 1.0 Wb flux);
+  *	   3 - same as 2 with low order polynomial atan2 (max error 1.6e-3 Rad).
+  *	   The angle is in range [-PI, PI] for all levels. The default of the
+  *	   constant time build profile (IM_WCET_PROFILE, see "im_wcet.h") is 2,
+  *	   the level 0 is not allowed there.
+  */
+#ifndef IM_FAST_MATH
+#ifdef IM_WCET_PROFILE
+#define IM_FAST_MATH		2
+#else
+#define IM_FAST_MATH		0
+#endif
+#endif
+
+#if defined(IM_WCET_PROFILE) && (IM_FAST_MATH == 0)
+#error "IM_WCET_PROFILE: the standard atan2f/hypotf (IM_FAST_MATH = 0) are not constant time"
+#endif
+
+#define IM_PI			3.14159265358979f	// PI
+#define IM_PI_DIV_2		1.57079632679490f	// PI/2
+#define IM_2PI			6.28318530717959f	// 2*PI
+
+/* Exported macro -----------------------------------------------------------------*/
+
+/**
+  * @brief Select of the float value by the condition: the conditional operator in
+  *	   the default build (the compiler may use a branch), the arithmetic blend
+  *	   "imSelf" in the constant time build profile (both values are always
+  *	   calculated).
+  */
+#ifdef IM_WCET_PROFILE
+#define IM_SELF(c, t, f)	imSelf((c), (t), (f))
+#else
+#define IM_SELF(c, t, f)	((c) ? (t) : (f))
+#endif
+
+/* Exported functions -------------------------------------------------------------*/
+
+/**
+  * @brief  Branch-free select of the float value: bitwise blend by the mask, the
+  *	    mask is opaque for the compiler (GCC/Clang), so the select is not
+  *	    converted back to the branch.
+  * @param  iCond: condition,
+  *	    fT: value for the true condition,
+  *	    fF: value for the false condition.
+  * @retval fT if iCond != 0, else fF.
+  */
+static inline float imSelf(int iCond, float fT, float fF)
+{
+	uint32_t uM = 0u - (uint32_t)(iCond != 0);
+	uint32_t uT, uF;
+
+#if defined(__GNUC__) || defined(__clang__)
+	__asm__ ("" : "+r" (uM));
+#endif
+	memcpy(&uT, &fT, sizeof(uT));
+	memcpy(&uF, &fF, sizeof(uF));
+	uT = (uT & uM) | (uF & ~uM);
+	memcpy(&fT, &uT, sizeof(fT));
+	return fT;
+}
+
+/**
+  * @brief  Polynomial arctangent of the argument in range [0, 1].
+  * @param  fT: argument (0 <= fT <= 1).
+  * @retval Arctangent, Rad.
+  */
+static inline float imAtanUnit(float fT)
+{
+#if IM_FAST_MATH == 3
+	// atan(t) = PI/4*t - t*(t - 1)*(0.2447 + 0.0663*t), |error| <= 1.6e-3 Rad
+	return 0.78539816f*fT - fT*(fT - 1.0f)*(0.2447f + 0.0663f*fT);
+#else
+	// Abramowitz & Stegun 4.4.49, |error| <= 1.0e-5 Rad
+	float fT2 = fT*fT;
+
+	return fT*(0.9998660f + fT2*(-0.3302995f + fT2*(0.1801410f +
+			fT2*(-0.0851330f + fT2*0.0208351f))));
+#endif
+}
+
+/**
+  * @brief  Rotor flux (vector) angle and magnitude calculation with the accuracy
+  *	    selected by IM_FAST_MATH.
+  * @param  fY: vector component Beta,
+  *	    fX: vector component Alpha,
+  *	    pfAng: pointer to the output angle, Rad,
+  *	    pfMagn: pointer to the output magnitude.
+  * @retval None
+  */
+static inline void imPolarf(float fY, float fX, float* pfAng, float* pfMagn)
+{
+#if IM_FAST_MATH == 0
+	*pfAng = atan2f(fY, fX);
+	*pfMagn = hypotf(fY, fX);
+#else
+	float fAbsX = fabsf(fX);
+	float fAbsY = fabsf(fY);
+	float fMax = IM_SELF(fAbsX > fAbsY, fAbsX, fAbsY);
+	float fMin = IM_SELF(fAbsX > fAbsY, fAbsY, fAbsX);
+	float fT = fMin/(fMax + 1.0e-30f);	// (0, 0) vector gives zero angle
+	float fAng = imAtanUnit(fT);
+
+	fAng = IM_SELF(fAbsY > fAbsX, IM_PI_DIV_2 - fAng, fAng);
+	fAng = IM_SELF(fX < 0.0f, IM_PI - fAng, fAng);
+	*pfAng = IM_SELF(fY < 0.0f, -fAng, fAng);
+#if IM_FAST_MATH == 1
+	*pfMagn = sqrtf(fX*fX + fY*fY);
+#else
+	// |(x, y)| = max*sqrt(1 + t^2), relative |error| <= 1.3e-4
+	*pfMagn = fMax*(1.00012796f + fT*(-0.00619499f + fT*(0.54786401f -
+			fT*0.12745546f)));
+#endif
+#endif
+}
+
+/**
+  * @brief  Cos and sin of the angle with the fixed count of operations: reduction to
+  *	    [-PI, PI], folding to [-PI/2, PI/2] and Taylor polynomials of the 11th
+  *	    (sin) and 12th (cos) order, |error| <= 4e-7 in [-PI, PI] and grows
+  *	    as 1e-7*|fAng| outside (reduction in single precision), used instead
+  *	    of "cosf"/"sinf" in the constant time build profile IM_WCET_PROFILE.
+  * @param  fAng: angle (|fAng| < 1.0e+9), Rad,
+  *	    pfCos: pointer to the output cos,
+  *	    pfSin: pointer to the output sin.
+  * @retval None
+  */
+static inline void imSinCosf(float fAng, float* pfCos, float* pfSin)
+{
+	float fR = fAng*(1.0f/IM_2PI);
+	float fX, fAbsX, fX2, fSgnC;
+	
+	fR -= (float)(int)(fR + copysignf(0.5f, fR));		// [-0.5, 0.5] turn
+	fX = fR*IM_2PI;
+	fAbsX = fabsf(fX);
+	fSgnC = IM_SELF(fAbsX > IM_PI_DIV_2, -1.0f, 1.0f);
+	fX = IM_SELF(fAbsX > IM_PI_DIV_2, copysignf(IM_PI, fX) - fX, fX);
+	fX2 = fX*fX;
+	*pfSin = fX*(1.0f + fX2*(-1.6666667e-1f + fX2*(8.3333333e-3f + fX2*(-1.9841270e-4f +
+		 fX2*(2.7557319e-6f - fX2*2.5052108e-8f)))));
+	*pfCos = fSgnC*(1.0f + fX2*(-0.5f + fX2*(4.1666667e-2f + fX2*(-1.3888889e-3f +
+		 fX2*(2.4801587e-5f + fX2*(-2.7557319e-7f + fX2*2.0876757e-9f))))));
+}
+
+/**
+  * @brief  Wrap of the angle to range [-PI, PI] (for increments less than 2*PI).
+  * @param  fAng: angle in range [-3*PI, 3*PI], Rad.
+  * @retval Angle in range [-PI, PI], Rad.
+  */
+static inline float imWrapPi(float fAng)
+{
+	fAng = IM_SELF(fAng > IM_PI, fAng - IM_2PI, fAng);
+	return IM_SELF(fAng < -IM_PI, fAng + IM_2PI, fAng);
+}
+
+/**
+  * @brief  Rotation of the unit vector (cos, sin) by the small angle atan(fTan) with
+  *	    the renormalization (one Newton step of 1/sqrt), |fTan| < 0.1.
+  * @param  pfCos: pointer to cos of the angle (input/output),
+  *	    pfSin: pointer to sin of the angle (input/output),
+  *	    fTan: tangent of the rotation angle.
+  * @retval None
+  */
+static inline void imRotUnit(float* pfCos, float* pfSin, float fTan)
+{
+	float fCos = *pfCos - *pfSin*fTan;
+	float fSin = *pfSin + *pfCos*fTan;
+	float fK = 1.5f - 0.5f*(fCos*fCos + fSin*fSin);
+
+	*pfCos = fCos*fK;
+	*pfSin = fSin*fK;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_FAST_MATH_H__ */
+
+/*********************************** END OF FILE ***********************************/
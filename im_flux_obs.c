@@ -0,0 +1,171 @@
+/**
+  ***********************************************************************************
+  * @file    im_flux_obs.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the full order
+  *	     speed adaptive observers of the induction motor:
+  *		+ pole placement gains table;
+  *		+ common step of the observers (model, correction, PI-adapter).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_flux_obs.h"
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Common step of the observers: prediction by the stator and rotor models,
+  *	    correction by the current error with the gains of the nearest table
+  *	    point, speed adaptation.
+  * @param  ptIMfluxObs: pointer to user data structure with type "tIMfluxObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    fSat: boundary layer of the switching correction (0 - disabled).
+  * @retval None
+  */
+static inline void tIMfluxObs_step(tIMfluxObs* ptIMfluxObs, const tIMparams* ptIMparams,
+				   float fSat)
+{
+	float fW = ptIMfluxObs->fWrE;
+	float fIa = ptIMfluxObs->fXIsAl, fIb = ptIMfluxObs->fXIsBe;
+	float fFa = ptIMfluxObs->fFrAl, fFb = ptIMfluxObs->fFrBe;
+	float fAbsW = IM_SELF(fW < 0.0f, -fW, fW);
+	float fSgn = IM_SELF(fW < 0.0f, -1.0f, 1.0f);
+	unsigned uIdx = (unsigned)(fAbsW*ptIMfluxObs->f1divStep + 0.5f);
+	const float* pfG;
+	float fErAl, fErBe, fEAl, fEBe, fGiIm, fGfIm;
+	
+	uIdx = (uIdx < IM_FLUX_OBS_GAINS) ? uIdx : IM_FLUX_OBS_GAINS - 1;
+	pfG = ptIMfluxObs->afGain[uIdx];
+	fGiIm = fSgn*pfG[1];
+	fGfIm = fSgn*pfG[3];
+	
+	// prediction (voltage of the step)
+	fErAl = imRotEmf(ptIMparams, fIa, fFa, fW*fFb);
+	fErBe = imRotEmf(ptIMparams, fIb, fFb, -fW*fFa);
+	fIa = fIa + (imStatEmfR(ptIMparams, ptIMfluxObs->fUsAl, fIa) - fErAl)*
+		    ptIMfluxObs->f1divKsd;
+	fIb = fIb + (imStatEmfR(ptIMparams, ptIMfluxObs->fUsBe, fIb) - fErBe)*
+		    ptIMfluxObs->f1divKsd;
+	fFa = fFa + ptIMparams->fDt*fErAl;
+	fFb = fFb + ptIMparams->fDt*fErBe;
+	
+	// current error (current of the step) and correction
+	fEAl = fIa - ptIMfluxObs->fIsAl;
+	fEBe = fIb - ptIMfluxObs->fIsBe;
+	if(fSat > 0.0f)					// sliding mode (constant)
+	{
+		fIa -= ptIMfluxObs->fSwDt*PID_SATF(fEAl, -fSat, fSat);
+		fIb -= ptIMfluxObs->fSwDt*PID_SATF(fEBe, -fSat, fSat);
+	}
+	ptIMfluxObs->fXIsAl = fIa + pfG[0]*fEAl - fGiIm*fEBe;
+	ptIMfluxObs->fXIsBe = fIb + fGiIm*fEAl + pfG[0]*fEBe;
+	ptIMfluxObs->fFrAl = fFa + pfG[2]*fEAl - fGfIm*fEBe;
+	ptIMfluxObs->fFrBe = fFb + fGfIm*fEAl + pfG[2]*fEBe;
+	
+	// speed adaptation
+	ptIMfluxObs->sPI.fIn = fEBe*fFa - fEAl*fFb;
+	ptIMfluxObs->sPI.m_calc(&ptIMfluxObs->sPI);
+	ptIMfluxObs->fWrE = ptIMfluxObs->sPI.fOut;
+	
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+	imPolarf(ptIMfluxObs->fFrBe, ptIMfluxObs->fFrAl, &ptIMfluxObs->fFrAng,
+		 &ptIMfluxObs->fFrMagn);
+#endif
+}
+
+/**
+  * @brief  IM full order observers initialization function: the gains table of the
+  *	    poles placement to fPoleK times of the motor poles, the PI-adapter
+  *	    discretization time. The model matrix (complex form, Is, Fr) is
+  *	    [-c1, c3*(a - j*w); b, -a + j*w] and the gains are Gi = (k - 1)*(-c1 -
+  *	    a + j*w), Gf = ((1 - k^2)*fRs/fSigLs - Gi)/c3, they are affine in speed,
+  *	    the table keeps the same step for the user designed gains (e.g. LQ per
+  *	    speed band loaded after the init). Must be called after every change of
+  *	    IM parameters.
+  * @param  ptIMfluxObs: pointer to user data structure with type "tIMfluxObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+void tIMfluxObs_init(tIMfluxObs* ptIMfluxObs, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	float fK = ptIMfluxObs->fPoleK;
+	float fDt = ptIMparams->fDt;
+	float fKr = ptIMparams->fLm/ptIMparams->fLr;
+	float fC1 = (ptIMparams->fRs + fKr*ptIMparams->fLmDivTr)/ptIMparams->fSigLs;
+	float fC3 = fKr/ptIMparams->fSigLs;
+	float fGiRe = (fK - 1.0f)*(-fC1 - ptIMparams->f1divTr);
+	float fGfRe = ((1.0f - fK*fK)*ptIMparams->fRs/ptIMparams->fSigLs - fGiRe)/fC3;
+	unsigned i;
+	
+	ptIMfluxObs->f1divKsd = 1.0f/ptIMparams->fKrSigLsDivDt;
+	ptIMfluxObs->f1divStep = (float)(IM_FLUX_OBS_GAINS - 1)/ptIMfluxObs->fWrMax;
+	ptIMfluxObs->fSwDt = fDt*ptIMfluxObs->fKsw/ptIMfluxObs->fPhi;
+	for(i = 0; i < IM_FLUX_OBS_GAINS; i++)
+	{
+		float fW = (float)i/ptIMfluxObs->f1divStep;
+		
+		ptIMfluxObs->afGain[i][0] = fDt*fGiRe;
+		ptIMfluxObs->afGain[i][1] = fDt*(fK - 1.0f)*fW;
+		ptIMfluxObs->afGain[i][2] = fDt*fGfRe;
+		ptIMfluxObs->afGain[i][3] = -fDt*(fK - 1.0f)*fW/fC3;
+	}
+	ptIMfluxObs->sPI.fDtSec = fDt;
+	ptIMfluxObs->sPI.m_init(&ptIMfluxObs->sPI);
+}
+
+/**
+  * @brief  IM Luenberger speed adaptive observer calculation function
+  * @param  ptIMfluxObs: pointer to user data structure with type "tIMfluxObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+void tIMfluxObs_calcLuen(tIMfluxObs* ptIMfluxObs,
+			 const tIMparams* IM_RESTRICT ptIMparams)
+{
+	tIMfluxObs_step(ptIMfluxObs, ptIMparams, 0.0f);
+}
+
+/**
+  * @brief  IM sliding mode speed adaptive observer calculation function
+  * @param  ptIMfluxObs: pointer to user data structure with type "tIMfluxObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+void tIMfluxObs_calcSmo(tIMfluxObs* ptIMfluxObs, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	tIMfluxObs_step(ptIMfluxObs, ptIMparams, ptIMfluxObs->fPhi);
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,166 @@
+/**
+  ***********************************************************************************
+  * @file    im_flux_obs.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the full order (stator current and rotor
+  *	     flux) speed adaptive observers of the induction motor:
+  *		+ Luenberger observer with the pole placement gains;
+  *		+ sliding mode observer (switching with the boundary layer added to
+  *		  the stator current correction);
+  *		+ gains table over the speed range (calculated at initialization or
+  *		  loaded by user), the step has the fixed cost.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_FLUX_OBS_H__
+#define __IM_FLUX_OBS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators.h" // Induction Motor estimators library
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Count of points of the observer gains table over the rotor speed range
+  *	   0...fWrMax (the nearest point is used, the gains of the negative speed
+  *	   are complex conjugate), can be overridden by the user at compile time.
+  */
+#ifndef IM_FLUX_OBS_GAINS
+#define IM_FLUX_OBS_GAINS	17
+#endif
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "IM full order speed adaptive observer Module" data structure. The model
+  *	   is the stator and rotor flux derivatives of "imStatEmfR"/"imRotEmf"
+  *	   (forward Euler), the correction is G*e of the current error
+  *	   e = Is_est - Is with the complex gains G = (Gi, Gf) of the nearest
+  *	   table point:
+  *		Luenberger (tIMfluxObs_calcLuen)   - linear correction only;
+  *		sliding mode (tIMfluxObs_calcSmo) - the stator current correction
+  *			-fKsw*sat(e/fPhi) is added (robust to the model errors, the
+  *			linear part keeps the flux and speed adaptation).
+  *	   The rotor speed is the output of the PI-adapter with the input
+  *	   eBe*FrAl - eAl*FrBe.
+  */
+typedef struct sIMfluxObs
+{
+// Inputs:
+	float		fUsAl;			// Stator voltage Alpha, Volts
+	float		fUsBe;			// Stator voltage Beta, Volts
+	float		fIsAl;			// Stator current Alpha, A
+	float		fIsBe;			// Stator current Beta, A
+	float		fWrMax;			// Speed range of the gains table,
+						// Rad/Sec
+	float		fPoleK;			// Observer poles to the motor poles
+						// ratio of the gains table (> 1)
+	float		fKsw;			// Sliding mode: switching gain of the
+						// stator current, A/Sec
+	float		fPhi;			// Sliding mode: boundary layer, A
+// Internal variables:
+	float		fXIsAl;			// Estimated stator current Alpha, A
+	float		fXIsBe;			// Estimated stator current Beta, A
+	float		f1divKsd;		// 1/fKrSigLsDivDt
+	float		f1divStep;		// 1/(speed step of the gains table)
+	float		fSwDt;			// fDt*fKsw/fPhi
+	float		afGain[IM_FLUX_OBS_GAINS][4];	// fDt*(Gi, Gf) (Re, Im)
+	tPI		sPI;			// PI-adapter of the rotor speed
+// Outputs:
+	float		fFrAl;			// Rotor flux Alpha, Wb
+	float		fFrBe;			// Rotor flux Beta, Wb
+	float		fWrE;			// Rotor electrical speed, Rad/Sec
+	float		fFrAng;			// Rotor flux angle, Rad
+	float		fFrMagn;		// Rotor flux magnitude, Wb
+// Functions:
+	void	(*m_init)(struct sIMfluxObs*,	// Pointer to initialization function
+			  const tIMparams* IM_RESTRICT);
+	void	(*m_calc)(struct sIMfluxObs*,	// Pointer to estimator function
+			  const tIMparams* IM_RESTRICT);
+} tIMfluxObs;
+
+/**
+  * @brief Initialization constants with defaults for "tIMfluxObs" user variables of
+  *	   the Luenberger and sliding mode observers (the gains depend on the IM
+  *	   parameters, m_init must be called after every change of them)
+  */
+#define IM_FLUX_OBS_COMMON_DEFAULTS		\
+	.fUsAl		= 0.0f,			\
+	.fUsBe		= 0.0f,			\
+	.fIsAl		= 0.0f,			\
+	.fIsBe		= 0.0f,			\
+	.fWrMax		= 2000.0f,		\
+	.fPoleK		= 1.5f,			\
+	.fKsw		= 1000.0f,		\
+	.fPhi		= 0.5f,			\
+	.fXIsAl		= 0.0f,			\
+	.fXIsBe		= 0.0f,			\
+	.sPI		= PI_DEFAULTS,		\
+	.fFrAl		= 0.0f,			\
+	.fFrBe		= 0.0f,			\
+	.fWrE		= 0.0f,			\
+	.fFrAng		= 0.0f,			\
+	.fFrMagn	= 0.0f,
+
+#define IM_FLUX_OBS_LUEN_DEFAULTS {		\
+	IM_FLUX_OBS_COMMON_DEFAULTS		\
+	.m_init		= tIMfluxObs_init,	\
+	.m_calc		= tIMfluxObs_calcLuen	\
+}
+
+#define IM_FLUX_OBS_SMO_DEFAULTS {		\
+	IM_FLUX_OBS_COMMON_DEFAULTS		\
+	.m_init		= tIMfluxObs_init,	\
+	.m_calc		= tIMfluxObs_calcSmo	\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* IM full order observers initialization (gains table) function prototype *********/
+void tIMfluxObs_init(tIMfluxObs*, const tIMparams* IM_RESTRICT);
+
+/* IM Luenberger speed adaptive observer function prototype ************************/
+void tIMfluxObs_calcLuen(tIMfluxObs*, const tIMparams* IM_RESTRICT);
+
+/* IM sliding mode speed adaptive observer function prototype **********************/
+void tIMfluxObs_calcSmo(tIMfluxObs*, const tIMparams* IM_RESTRICT);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_FLUX_OBS_H__ */
+
+/*********************************** END OF FILE ***********************************/
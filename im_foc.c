@@ -0,0 +1,148 @@
+/**
+  ***********************************************************************************
+  * @file    im_foc.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the sensorless
+  *	     field oriented control pipeline of the induction motor:
+  *		+ initialization of the observer and current controllers;
+  *		+ fused Clarke - observer - Park - PI - inverse Park - SVPWM step.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_foc.h"
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+/* Private constants --------------------------------------------------------------*/
+#define IM_FOC_1DIV_SQRT3	0.577350269189626f	// 1/sqrt(3)
+#define IM_FOC_SQRT3_DIV_2	0.866025403784439f	// sqrt(3)/2
+
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  IM sensorless FOC pipeline initialization function: the speed observer is
+  *	    initialized and the current controllers discretization time is set to
+  *	    the PWM period (fDt of IM parameters). Must be called after every change
+  *	    of IM parameters or controllers coefficients.
+  * @param  ptIMfoc: pointer to user data structure with type "tIMfoc",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+void tIMfoc_init(tIMfoc* ptIMfoc, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	ptIMfoc->sIMspeedObs.m_init(&ptIMfoc->sIMspeedObs, ptIMparams);
+	
+	ptIMfoc->sPId.fDtSec = ptIMparams->fDt;
+	ptIMfoc->sPId.m_init(&ptIMfoc->sPId);
+	ptIMfoc->sPIq.fDtSec = ptIMparams->fDt;
+	ptIMfoc->sPIq.m_init(&ptIMfoc->sPIq);
+}
+
+/**
+  * @brief  IM sensorless FOC pipeline calculation function (one call per PWM period
+  *	    after the phase currents sampling).
+  * @param  ptIMfoc: pointer to user data structure with type "tIMfoc",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+void tIMfoc_calc(tIMfoc* ptIMfoc, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	tIMspeedObs* ptObs = &ptIMfoc->sIMspeedObs;
+	float fCos, fSin, fUd, fUq, fUm2, fUlim, fUAl, fUBe;
+	float fUa, fUb, fUc, fMax, fMin, f1divUdc, fOfs;
+	
+	// Clarke transform to the observer inputs, the observer voltage inputs are
+	// the outputs of the previous period
+	ptObs->fIsAl = ptIMfoc->fIa;
+	ptObs->fIsBe = IM_FOC_1DIV_SQRT3*(ptIMfoc->fIa + 2.0f*ptIMfoc->fIb);
+	ptObs->m_calc(ptObs, ptIMparams);
+	fCos = ptObs->fFrCos;
+	fSin = ptObs->fFrSin;
+	
+	// Park transform and current controllers
+	ptIMfoc->fId = fCos*ptObs->fIsAl + fSin*ptObs->fIsBe;
+	ptIMfoc->fIq = fCos*ptObs->fIsBe - fSin*ptObs->fIsAl;
+	ptIMfoc->sPId.fIn = ptIMfoc->fIdRef - ptIMfoc->fId;
+	ptIMfoc->sPId.m_calc(&ptIMfoc->sPId);
+	ptIMfoc->sPIq.fIn = ptIMfoc->fIqRef - ptIMfoc->fIq;
+	ptIMfoc->sPIq.m_calc(&ptIMfoc->sPIq);
+	
+	// Limitation to the linear range of SVPWM
+	fUd = ptIMfoc->sPId.fOut;
+	fUq = ptIMfoc->sPIq.fOut;
+	fUm2 = fUd*fUd + fUq*fUq;
+	fUlim = IM_FOC_1DIV_SQRT3*ptIMfoc->fUdc;
+#ifdef IM_WCET_PROFILE
+	{
+		// the scale is calculated always (constant time), K = 1 inside the circle
+		float fK = fUlim/sqrtf(fUm2 + 1.0e-30f);
+		
+		fK = IM_SELF(fK < 1.0f, fK, 1.0f);
+		
+		fUd *= fK;
+		fUq *= fK;
+	}
+#else
+	if(fUm2 > fUlim*fUlim)
+	{
+		float fK = fUlim/sqrtf(fUm2);
+		
+		fUd *= fK;
+		fUq *= fK;
+	}
+#endif
+	ptIMfoc->fUd = fUd;
+	ptIMfoc->fUq = fUq;
+	
+	// Inverse Park transform to the observer inputs of the next period
+	fUAl = fCos*fUd - fSin*fUq;
+	fUBe = fSin*fUd + fCos*fUq;
+	ptObs->fUsAl = fUAl;
+	ptObs->fUsBe = fUBe;
+	
+	// SVPWM: phase voltages with min-max zero sequence injection
+	fUa = fUAl;
+	fUb = -0.5f*fUAl + IM_FOC_SQRT3_DIV_2*fUBe;
+	fUc = -0.5f*fUAl - IM_FOC_SQRT3_DIV_2*fUBe;
+	fMax = (fUa > fUb) ? fUa : fUb;
+	fMax = (fUc > fMax) ? fUc : fMax;
+	fMin = (fUa < fUb) ? fUa : fUb;
+	fMin = (fUc < fMin) ? fUc : fMin;
+	fOfs = -0.5f*(fMax + fMin);
+	f1divUdc = IM_SELF(ptIMfoc->fUdc > 0.0f, 1.0f/ptIMfoc->fUdc, 0.0f);
+	
+	ptIMfoc->fDutyA = 0.5f + (fUa + fOfs)*f1divUdc;
+	ptIMfoc->fDutyB = 0.5f + (fUb + fOfs)*f1divUdc;
+	ptIMfoc->fDutyC = 0.5f + (fUc + fOfs)*f1divUdc;
+}
+
+/*********************************** END OF FILE ***********************************/
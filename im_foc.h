@@ -0,0 +1,144 @@
+/**
+  ***********************************************************************************
+  * @file    im_foc.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the sensorless field oriented control
+  *	     (FOC) pipeline of the induction motor (one call per PWM period):
+  *		+ Clarke transform of the phase currents;
+  *		+ rotor speed and flux observer (tIMspeedObs);
+  *		+ Park transform, d/q current PI-controllers, inverse Park transform;
+  *		+ space vector PWM (min-max zero sequence injection).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_FOC_H__
+#define __IM_FOC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators.h" // Induction Motor estimators library
+
+#ifdef IM_SPEED_OBS_NO_FLUX_POLAR
+#error "The FOC pipeline uses the rotor flux sin/cos of the speed observer"
+#endif
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "IM sensorless FOC pipeline Module" data structure. The stages share the
+  *	   state: the Clarke transform writes the stator current directly to the
+  *	   observer inputs, the Park transforms use the observer flux sin/cos and
+  *	   the inverse Park transform writes the stator voltage directly to the
+  *	   observer inputs (the voltage of the next PWM period is the observer
+  *	   input of the next call).
+  */
+typedef struct sIMfoc
+{
+// Inputs:
+	float		fIa;			// Phase A current, A
+	float		fIb;			// Phase B current, A
+	float		fUdc;			// DC link voltage, Volts
+	float		fIdRef;			// Flux producing current reference, A
+	float		fIqRef;			// Torque producing current reference, A
+// Internal variables:
+	tIMspeedObs	sIMspeedObs;		// Speed and flux observer (the rotor flux
+						// frame of d/q axes)
+	tPI		sPId;			// d-axis current PI-controller
+	tPI		sPIq;			// q-axis current PI-controller
+// Outputs:
+	float		fId;			// d-axis stator current, A
+	float		fIq;			// q-axis stator current, A
+	float		fUd;			// d-axis stator voltage (limited), Volts
+	float		fUq;			// q-axis stator voltage (limited), Volts
+	float		fDutyA;			// Phase A PWM duty cycle (0...1)
+	float		fDutyB;			// Phase B PWM duty cycle (0...1)
+	float		fDutyC;			// Phase C PWM duty cycle (0...1)
+// Functions:
+	void	(*m_init)(struct sIMfoc*,	// Pointer to initialization function
+			  const tIMparams* IM_RESTRICT);
+	void	(*m_calc)(struct sIMfoc*,	// Pointer to pipeline function
+			  const tIMparams* IM_RESTRICT);
+} tIMfoc;
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Initialization constant with defaults for "tIMfoc" user variables (the
+  *	   observer and current controllers coefficients are set by the user, the
+  *	   discretization time of the current controllers is set by m_init)
+  */
+#define IM_FOC_DEFAULTS {			\
+	.fIa		= 0.0f,			\
+	.fIb		= 0.0f,			\
+	.fUdc		= 0.0f,			\
+	.fIdRef		= 0.0f,			\
+	.fIqRef		= 0.0f,			\
+	.sIMspeedObs	= IM_SPEED_OBS_DEFAULTS,\
+	.sPId		= PI_DEFAULTS,		\
+	.sPIq		= PI_DEFAULTS,		\
+	.fId		= 0.0f,			\
+	.fIq		= 0.0f,			\
+	.fUd		= 0.0f,			\
+	.fUq		= 0.0f,			\
+	.fDutyA		= 0.5f,			\
+	.fDutyB		= 0.5f,			\
+	.fDutyC		= 0.5f,			\
+	.m_init		= tIMfoc_init,		\
+	.m_calc		= tIMfoc_calc		\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+
+/**
+  * @brief The d/q voltage vector is limited to the linear range of SVPWM (the circle
+  *	   of fUdc/sqrt(3) radius) with the same angle, the output limits of the
+  *	   current controllers should be set not above this radius with the
+  *	   anti-windup (uAwMode) enabled. The phase currents and the voltage are in
+  *	   the amplitude-invariant scaling (Ia + Ib + Ic = 0).
+  */
+
+/* Exported functions -------------------------------------------------------------*/
+
+/* IM sensorless FOC pipeline initialization function prototype ********************/
+void tIMfoc_init(tIMfoc*, const tIMparams* IM_RESTRICT);
+
+/* IM sensorless FOC pipeline function prototype ***********************************/
+void tIMfoc_calc(tIMfoc*, const tIMparams* IM_RESTRICT);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_FOC_H__ */
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,145 @@
+/**
+  ***********************************************************************************
+  * @file    im_params_est.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the online
+  *	     estimator of the induction motor resistances:
+  *		+ back-EMF error accumulation (ISR rate);
+  *		+ stator and rotor resistances update and publishing (background).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_params_est.h"
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the IM resistances estimator: nominal resistances are taken
+  *	    from IM parameters, the default Rs limits are 0.5...2 of nominal.
+  * @param  ptIMparamsEst: pointer to user data structure with type "tIMparamsEst",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+void tIMparamsEst_init(tIMparamsEst* ptIMparamsEst, const tIMparams* ptIMparams)
+{
+	ptIMparamsEst->fRs0 = ptIMparamsEst->fRs = ptIMparams->fRs;
+	ptIMparamsEst->fRr0 = ptIMparamsEst->fRr = ptIMparams->fRr;
+	if(ptIMparamsEst->fRsMin <= 0.0f) ptIMparamsEst->fRsMin = 0.5f*ptIMparams->fRs;
+	if(ptIMparamsEst->fRsMax <= 0.0f) ptIMparamsEst->fRsMax = 2.0f*ptIMparams->fRs;
+	
+	ptIMparamsEst->asAcc[0].fIsErr = ptIMparamsEst->asAcc[1].fIsErr = 0.0f;
+	ptIMparamsEst->asAcc[0].fIsIs = ptIMparamsEst->asAcc[1].fIsIs = 0.0f;
+	ptIMparamsEst->asAcc[0].uNum = ptIMparamsEst->asAcc[1].uNum = 0;
+	ptIMparamsEst->uAcc = 0;
+	ptIMparamsEst->uUpdates = 0;
+}
+
+/**
+  * @brief  Accumulate the back-EMF error of the speed observer step (call in the ISR
+  *	    after the speed observer calculation, the multi-rate speed observer
+  *	    steps are accumulated at the sub-rate). The stator current is read
+  *	    from the observer inputs (the sBind signals of "tIMspeedObs_calcBound").
+  * @param  ptIMparamsEst: pointer to user data structure with type "tIMparamsEst",
+  *	    ptIMspeedObs: pointer to user data structure with type "tIMspeedObs".
+  * @retval None
+  */
+void tIMparamsEst_acc(tIMparamsEst* ptIMparamsEst, const tIMspeedObs* ptIMspeedObs)
+{
+	tIMparamsEstAcc* ptAcc = &ptIMparamsEst->asAcc[IM_LOAD_ACQ(ptIMparamsEst->uAcc)];
+	const int iBound = (ptIMspeedObs->m_calc == tIMspeedObs_calcBound);
+	float fIsAl, fIsBe;
+	
+	// raw stator current of the step (not the filtered one of "tIMstatObs_calcFilt")
+	fIsAl = iBound ? *ptIMspeedObs->sBind.pfIsAl : ptIMspeedObs->fIsAl;
+	fIsBe = iBound ? *ptIMspeedObs->sBind.pfIsBe : ptIMspeedObs->fIsBe;
+	
+	if(ptIMspeedObs->uDecimCnt != 0) return;	// rotor observer is not updated
+	
+	ptAcc->fIsErr += fIsAl*(ptIMspeedObs->sIMstatObs.fEsAl - ptIMspeedObs->sIMrotObs.fErAl) +
+			 fIsBe*(ptIMspeedObs->sIMstatObs.fEsBe - ptIMspeedObs->sIMrotObs.fErBe);
+	ptAcc->fIsIs += fIsAl*fIsAl + fIsBe*fIsBe;
+	ptAcc->uNum++;
+}
+
+/**
+  * @brief  Update the IM resistances by the accumulated back-EMF error and publish
+  *	    them (background task, the ISR and the task run on the same core): the
+  *	    accumulators are switched, only the resistances dependent coefficients
+  *	    of the back IM parameters set are recalculated ("tIMparams_updR") and
+  *	    the set is activated by the pointer swap.
+  * @param  ptIMparamsEst: pointer to user data structure with type "tIMparamsEst",
+  *	    ptIMparamsDb: pointer to user data structure with type "tIMparamsDb".
+  * @retval 1 - new parameters are published, 0 - not enough excitation (the
+  *	    stator current is less than fIsMin), no accumulated steps or the last
+  *	    published parameters are not used by the estimators yet.
+  */
+int tIMparamsEst_calc(tIMparamsEst* ptIMparamsEst, tIMparamsDb* ptIMparamsDb)
+{
+	unsigned uAcc = ptIMparamsEst->uAcc;
+	tIMparamsEstAcc* ptAcc = &ptIMparamsEst->asAcc[uAcc];
+	tIMparams* ptBack = tIMparamsDb_back(ptIMparamsDb);
+	float fIsErr, fIsIs, fRs;
+	unsigned uNum;
+	
+	if(ptBack == 0) return 0;			// last update is not taken yet
+	
+	IM_STORE_REL(ptIMparamsEst->uAcc, uAcc ^ 1u);	// ISR uses the other one
+	
+	fIsErr = ptAcc->fIsErr;
+	fIsIs = ptAcc->fIsIs;
+	uNum = ptAcc->uNum;
+	ptAcc->fIsErr = 0.0f;
+	ptAcc->fIsIs = 0.0f;
+	ptAcc->uNum = 0;
+	
+	if((uNum == 0) || (fIsIs <= ptIMparamsEst->fIsMin*ptIMparamsEst->fIsMin*(float)uNum))
+		return 0;
+	
+	// Rs error estimate: -(Rs^ - Rs) = sum(Is*(Es - Er))/(f1divKr*sum(|Is|^2))
+	fRs = ptIMparamsEst->fRs + ptIMparamsEst->fGainRs*fIsErr/(ptBack->f1divKr*fIsIs);
+	if(fRs > ptIMparamsEst->fRsMax) fRs = ptIMparamsEst->fRsMax;
+	if(fRs < ptIMparamsEst->fRsMin) fRs = ptIMparamsEst->fRsMin;
+	
+	ptIMparamsEst->fRs = fRs;
+	ptIMparamsEst->fRr = ptIMparamsEst->fRr0*(1.0f + ptIMparamsEst->fTcRatio*
+			     (fRs/ptIMparamsEst->fRs0 - 1.0f));
+	
+	tIMparams_updR(ptBack, ptIMparamsEst->fRs, ptIMparamsEst->fRr);
+	tIMparamsDb_swap(ptIMparamsDb);
+	ptIMparamsEst->uUpdates++;
+	return 1;
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,137 @@
+/**
+  ***********************************************************************************
+  * @file    im_params_est.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the online estimator of the induction
+  *	     motor (IM) resistances:
+  *		+ MRAS adaptation of the stator resistance by the active component
+  *		  of the speed observer back-EMF error (ISR accumulation, background
+  *		  update);
+  *		+ rotor resistance tracking by the thermal drift of stator one;
+  *		+ publishing of the updated parameters by "tIMparamsDb" swap.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_PARAMS_EST_H__
+#define __IM_PARAMS_EST_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators.h" // Induction Motor estimators library
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "Back-EMF error accumulator" data structure (written by the ISR)
+  */
+typedef struct sIMparamsEstAcc
+{
+	float		fIsErr;			// Sum of Is*(Es - Er) (active component)
+	float		fIsIs;			// Sum of |Is|^2
+	unsigned	uNum;			// Count of accumulated steps
+} tIMparamsEstAcc;
+
+/**
+  * @brief "IM resistances online estimator Module" data structure. The stator
+  *	   resistance error gives the back-EMF error in phase with the stator
+  *	   current: Is*(Es - Er) = -(fRs^ - fRs)*f1divKr*|Is|^2, the average of
+  *	   it over the background period corrects fRs^. The rotor resistance is
+  *	   not observable separately from the speed by the sensorless observer
+  *	   in steady state, it follows the relative thermal drift of fRs^:
+  *	   fRr^ = fRr0*(1 + fTcRatio*(fRs^/fRs0 - 1)).
+  */
+typedef struct sIMparamsEst
+{
+// Inputs:
+	float		fGainRs;		// Rs correction part per update (0...1,
+						// 0 - Rs is not estimated)
+	float		fRsMin;			// Stator resistance lower limit, Ohm
+	float		fRsMax;			// Stator resistance upper limit, Ohm
+	float		fTcRatio;		// Rotor/stator resistance temperature
+						// coef. ratio (0 - Rr is not changed)
+	float		fIsMin;			// Min stator current RMS of adaptation, A
+// Internal variables:
+	tIMparamsEstAcc	asAcc[2];		// Accumulators (ISR and background)
+	volatile unsigned uAcc;			// Index of the accumulator of ISR
+	float		fRs0;			// Nominal stator resistance, Ohm
+	float		fRr0;			// Nominal rotor resistance, Ohm
+// Outputs:
+	float		fRs;			// Estimated stator resistance, Ohm
+	float		fRr;			// Estimated rotor resistance, Ohm
+	unsigned	uUpdates;		// Count of published parameters updates
+// Functions:
+	void	(*m_init)(struct sIMparamsEst*,	// Pointer to initialization function
+			  const tIMparams*);
+	void	(*m_acc)(struct sIMparamsEst*,	// Pointer to ISR accumulation function
+			 const tIMspeedObs*);
+	int	(*m_calc)(struct sIMparamsEst*,	// Pointer to background update function
+			  tIMparamsDb*);
+} tIMparamsEst;
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Initialization constant with defaults for "tIMparamsEst" user variables
+  *	   (the nominal resistances and limits are set by m_init from IM parameters
+  *	   when fRsMin and fRsMax are zeros)
+  */
+#define IM_PARAMS_EST_DEFAULTS {		\
+	.fGainRs	= 0.1f,			\
+	.fRsMin		= 0.0f,			\
+	.fRsMax		= 0.0f,			\
+	.fTcRatio	= 1.0f,			\
+	.fIsMin		= 0.1f,			\
+	.m_init		= tIMparamsEst_init,	\
+	.m_acc		= tIMparamsEst_acc,	\
+	.m_calc		= tIMparamsEst_calc	\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* IM resistances estimator initialization function prototype **********************/
+void tIMparamsEst_init(tIMparamsEst*, const tIMparams*);
+
+/* IM resistances estimator ISR accumulation function prototype ********************/
+void tIMparamsEst_acc(tIMparamsEst*, const tIMspeedObs*);
+
+/* IM resistances estimator background update function prototype ******************/
+int tIMparamsEst_calc(tIMparamsEst*, tIMparamsDb*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_PARAMS_EST_H__ */
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,238 @@
+/**
+  ***********************************************************************************
+  * @file    im_plant.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the batched
+  *	     induction motor plant model:
+  *		+ profiles interpolation and V/f supply voltage generation;
+  *		+ RK2 integration of the motors dynamics (vectorizable over motors).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_plant.h"
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Value of the supply frequency and load torque profile at the given time
+  *	    (linear interpolation).
+  * @param  ptProfile: pointer to user data structure with type "tIMprofile",
+  *	    fT: time, Sec,
+  *	    pfWs: pointer to the output supply electrical frequency, Rad/Sec,
+  *	    pfTl: pointer to the output load torque, N*m.
+  * @retval None
+  */
+void tIMprofile_get(const tIMprofile* ptProfile, float fT, float* pfWs, float* pfTl)
+{
+	unsigned n = 1;
+	float fK;
+	
+	if((ptProfile->uNum < 2) || (fT <= ptProfile->afT[0]))
+	{
+		*pfWs = ptProfile->afWs[0];
+		*pfTl = ptProfile->afTl[0];
+		return;
+	}
+	while((n < ptProfile->uNum - 1) && (fT > ptProfile->afT[n])) n++;
+	if(fT >= ptProfile->afT[n])
+	{
+		*pfWs = ptProfile->afWs[n];
+		*pfTl = ptProfile->afTl[n];
+		return;
+	}
+	fK = (fT - ptProfile->afT[n - 1])/(ptProfile->afT[n] - ptProfile->afT[n - 1]);
+	*pfWs = ptProfile->afWs[n - 1] + fK*(ptProfile->afWs[n] - ptProfile->afWs[n - 1]);
+	*pfTl = ptProfile->afTl[n - 1] + fK*(ptProfile->afTl[n] - ptProfile->afTl[n - 1]);
+}
+
+/**
+  * @brief  IM plant models bank initialization: the model coefficients are
+  *	    calculated (no divisions in m_calc) and the profiles are checked, the
+  *	    V/f supply angle step of every profile point must satisfy the range of
+  *	    "imRotUnit" (|tan| < 0.1, i.e. |fWs*fDt| < 0.0997 Rad).
+  * @param  ptBank: pointer to user data structure with type "tIMplantBank",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams"
+  *	    (initialized).
+  * @retval 0 - Ok, -1 - not valid inertia or profile.
+  */
+int tIMplantBank_init(tIMplantBank* ptBank, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	unsigned i, n;
+	
+	ptBank->uSubInit = (ptBank->uSub > 0) ? ptBank->uSub : 1;
+	ptBank->fH = ptIMparams->fDt/(float)ptBank->uSubInit;
+	ptBank->fHalfH = 0.5f*ptBank->fH;
+	ptBank->fKr = ptIMparams->fLm/ptIMparams->fLr;
+	ptBank->f1divSigLs = 1.0f/ptIMparams->fSigLs;
+	ptBank->fKt = 1.5f*ptIMparams->fNpP*ptBank->fKr;
+	
+	if(!(ptBank->fJ > 0.0f)) return -1;
+	ptBank->fKm = ptIMparams->fNpP/ptBank->fJ;
+	ptBank->fBdivJ = ptBank->fB/ptBank->fJ;
+	
+	for(i = 0; i < IM_PLANT_BANK_SIZE; i++)
+	{
+		const tIMprofile* ptProfile = ptBank->aptProfile[i];
+		
+		if(ptProfile == 0) continue;
+		if(ptProfile->uNum > IM_PROFILE_POINTS) return -1;
+		for(n = 0; (n == 0) || (n < ptProfile->uNum); n++)
+		{
+			float fStep = fabsf(ptProfile->afWs[n])*ptIMparams->fDt;
+			
+			if(!(fStep*(1.0f + fStep*fStep*(1.0f/3.0f)) < 0.1f)) return -1;
+		}
+	}
+	return 0;
+}
+
+/**
+  * @brief  IM plant models bank step: the stator voltage and load torque of the
+  *	    motors with profile are generated, then the state of all motors is
+  *	    integrated over the fDt period (the outputs are the state at the end
+  *	    of the period, i.e. the samples of the next estimators step).
+  * @param  ptBank: pointer to user data structure with type "tIMplantBank"
+  *	    (initialized by m_init),
+  *	    ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    uNum: count of simulated motors (<= IM_PLANT_BANK_SIZE).
+  * @retval None
+  */
+void tIMplantBank_calc(tIMplantBank* ptBank, const tIMparams* IM_RESTRICT ptIMparams,
+		       unsigned uNum)
+{
+	const unsigned uSub = ptBank->uSubInit;
+	const float fH = ptBank->fH;
+	const float fHalfH = ptBank->fHalfH;
+	const float fA = ptIMparams->f1divTr;
+	const float fB = ptIMparams->fLmDivTr;
+	const float fKr = ptBank->fKr;
+	const float fRs = ptIMparams->fRs;
+	const float f1divSigLs = ptBank->f1divSigLs;
+	const float fKt = ptBank->fKt;
+	const float fKm = ptBank->fKm;				// dWrE/dt per N*m
+	const float fBdivJ = ptBank->fBdivJ;
+	unsigned i, s;
+	
+	if(uNum > IM_PLANT_BANK_SIZE) uNum = IM_PLANT_BANK_SIZE;
+	
+	// Profiles and V/f supply (held over the period)
+	for(i = 0; i < uNum; i++)
+	{
+		float fWs, fTl, fUs, fStep;
+		
+		if(ptBank->aptProfile[i] == 0) continue;
+		tIMprofile_get(ptBank->aptProfile[i], ptBank->fTime, &fWs, &fTl);
+		fUs = ptBank->fVdivF*fabsf(fWs) + ptBank->fVboost;
+		ptBank->afUsAl[i] = fUs*ptBank->afSupCos[i];
+		ptBank->afUsBe[i] = fUs*ptBank->afSupSin[i];
+		ptBank->afTl[i] = fTl;
+		fStep = fWs*ptIMparams->fDt;
+		imRotUnit(&ptBank->afSupCos[i], &ptBank->afSupSin[i],
+			  fStep*(1.0f + fStep*fStep*(1.0f/3.0f)));	// tan(fStep)
+	}
+	
+	// Motors dynamics (Heun steps, the same operations for all motors)
+	for(s = 0; s < uSub; s++)
+	{
+		for(i = 0; i < uNum; i++)
+		{
+			float fIa = ptBank->afIsAl[i], fIb = ptBank->afIsBe[i];
+			float fFa = ptBank->afFrAl[i], fFb = ptBank->afFrBe[i];
+			float fW = ptBank->afWrE[i];
+			float fUa = ptBank->afUsAl[i], fUb = ptBank->afUsBe[i];
+			float fTl = ptBank->afTl[i];
+			float fTe, fDFa1, fDFb1, fDIa1, fDIb1, fDW1;
+			float fDFa2, fDFb2, fDIa2, fDIb2, fDW2;
+			float fIa2, fIb2, fFa2, fFb2, fW2;
+			
+			fDFa1 = fB*fIa - fA*fFa - fW*fFb;
+			fDFb1 = fB*fIb - fA*fFb + fW*fFa;
+			fDIa1 = (fUa - fRs*fIa - fKr*fDFa1)*f1divSigLs;
+			fDIb1 = (fUb - fRs*fIb - fKr*fDFb1)*f1divSigLs;
+			fTe = fKt*(fFa*fIb - fFb*fIa);
+			fDW1 = fKm*(fTe - fTl) - fBdivJ*fW;
+			
+			fIa2 = fIa + fH*fDIa1;
+			fIb2 = fIb + fH*fDIb1;
+			fFa2 = fFa + fH*fDFa1;
+			fFb2 = fFb + fH*fDFb1;
+			fW2 = fW + fH*fDW1;
+			
+			fDFa2 = fB*fIa2 - fA*fFa2 - fW2*fFb2;
+			fDFb2 = fB*fIb2 - fA*fFb2 + fW2*fFa2;
+			fDIa2 = (fUa - fRs*fIa2 - fKr*fDFa2)*f1divSigLs;
+			fDIb2 = (fUb - fRs*fIb2 - fKr*fDFb2)*f1divSigLs;
+			fDW2 = fKm*(fKt*(fFa2*fIb2 - fFb2*fIa2) - fTl) - fBdivJ*fW2;
+			
+			ptBank->afIsAl[i] = fIa + fHalfH*(fDIa1 + fDIa2);
+			ptBank->afIsBe[i] = fIb + fHalfH*(fDIb1 + fDIb2);
+			ptBank->afFrAl[i] = fFa + fHalfH*(fDFa1 + fDFa2);
+			ptBank->afFrBe[i] = fFb + fHalfH*(fDFb1 + fDFb2);
+			ptBank->afWrE[i] = fW + fHalfH*(fDW1 + fDW2);
+		}
+	}
+	
+	for(i = 0; i < uNum; i++)
+	{
+		ptBank->afTe[i] = fKt*(ptBank->afFrAl[i]*ptBank->afIsBe[i] -
+				       ptBank->afFrBe[i]*ptBank->afIsAl[i]);
+	}
+	ptBank->uStep++;
+	ptBank->fTime = (float)ptBank->uStep*ptIMparams->fDt;
+}
+
+/**
+  * @brief  Reset the state of IM plant models bank: standstill and zero currents
+  *	    and flux of all motors, zero supply angle and simulation time.
+  * @param  ptBank: pointer to user data structure with type "tIMplantBank".
+  * @retval None
+  */
+void tIMplantBank_rst(tIMplantBank* ptBank)
+{
+	unsigned i;
+	
+	for(i = 0; i < IM_PLANT_BANK_SIZE; i++)
+	{
+		ptBank->afSupCos[i] = 1.0f;
+		ptBank->afSupSin[i] = 0.0f;
+		ptBank->afIsAl[i] = ptBank->afIsBe[i] = 0.0f;
+		ptBank->afFrAl[i] = ptBank->afFrBe[i] = 0.0f;
+		ptBank->afWrE[i] = ptBank->afTe[i] = 0.0f;
+	}
+	ptBank->uStep = 0;
+	ptBank->fTime = 0.0f;
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,177 @@
+/**
+  ***********************************************************************************
+  * @file    im_plant.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the batched induction motor plant model
+  *	     (regression tests and benchmarks of the estimators with the ground
+  *	     truth rotor flux and speed):
+  *		+ stator current, rotor flux and rotor speed dynamics (tIMparams);
+  *		+ open-loop V/f supply and load torque profiles generator;
+  *		+ closed-loop mode with the stator voltage of the user controller.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_PLANT_H__
+#define __IM_PLANT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators.h" // Induction Motor estimators library
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Max count of simulated motors (scenarios) stored in one "tIMplantBank"
+  *	   variable and max count of the profile points, can be overridden by the
+  *	   user at compile time.
+  */
+#ifndef IM_PLANT_BANK_SIZE
+#define IM_PLANT_BANK_SIZE	16
+#endif
+
+#ifndef IM_PROFILE_POINTS
+#define IM_PROFILE_POINTS	8
+#endif
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "Supply frequency and load torque profile" data structure (piecewise linear
+  *	   functions of time, the values are held before the first and after the
+  *	   last point)
+  */
+typedef struct sIMprofile
+{
+	unsigned	uNum;				// Count of points (1...
+							// IM_PROFILE_POINTS)
+	float		afT[IM_PROFILE_POINTS];		// Time of points (ascending), Sec
+	float		afWs[IM_PROFILE_POINTS];	// Supply electrical frequency,
+							// Rad/Sec
+	float		afTl[IM_PROFILE_POINTS];	// Load torque, N*m
+} tIMprofile;
+
+/**
+  * @brief "IM plant models Bank Module" data structure. Every array element [i] holds
+  *	   the data of the i-th motor (scenario), all motors have the same IM
+  *	   parameters and mechanics. The model (stationary frame, the same
+  *	   equations as the estimators use):
+  *		dFr/dt = fLmDivTr*Is - f1divTr*Fr + j*fWrE*Fr,
+  *		Us = fRs*Is + fSigLs*dIs/dt + (fLm/fLr)*dFr/dt,
+  *		Te = 1.5*fNpP*(fLm/fLr)*(FrAl*IsBe - FrBe*IsAl),
+  *		fJ*dWm/dt = Te - Tl - fB*Wm, fWrE = fNpP*Wm,
+  *	   is integrated by the 2nd order Runge-Kutta (Heun) method with uSub
+  *	   steps per fDt, the stator voltage is held over the fDt period.
+  *	   m_init must be called after the change of IM parameters, fJ, fB, uSub
+  *	   or profiles.
+  */
+typedef struct sIMplantBank
+{
+// Inputs:
+	const tIMprofile* aptProfile[IM_PLANT_BANK_SIZE];	// V/f supply and load
+							// profile (NULL - afUsAl,
+							// afUsBe, afTl are inputs)
+	float	afUsAl[IM_PLANT_BANK_SIZE];		// Stator voltage Alpha, Volts
+	float	afUsBe[IM_PLANT_BANK_SIZE];		// Stator voltage Beta, Volts
+	float	afTl[IM_PLANT_BANK_SIZE];		// Load torque, N*m
+	float	fJ;					// Rotor and load inertia, kg*m^2
+	float	fB;					// Viscous friction, N*m*Sec
+	float	fVdivF;					// V/f supply voltage per
+							// frequency, Volts/(Rad/Sec)
+	float	fVboost;				// V/f supply voltage boost, Volts
+	unsigned uSub;					// Integration steps per fDt
+// Internal variables:
+	unsigned uSubInit;				// Integration steps per fDt (>= 1)
+	float	fH;					// Integration step fDt/uSubInit, Sec
+	float	fHalfH;					// 0.5*fH
+	float	fKr;					// fLm/fLr
+	float	f1divSigLs;				// 1/fSigLs
+	float	fKt;					// 1.5*fNpP*fKr
+	float	fKm;					// fNpP/fJ
+	float	fBdivJ;					// fB/fJ
+	float	afSupCos[IM_PLANT_BANK_SIZE];		// V/f supply voltage angle cos
+	float	afSupSin[IM_PLANT_BANK_SIZE];		// V/f supply voltage angle sin
+	unsigned uStep;					// Count of simulated periods
+// Outputs:
+	float	fTime;					// Simulation time, Sec
+	float	afIsAl[IM_PLANT_BANK_SIZE];		// Stator current Alpha, A
+	float	afIsBe[IM_PLANT_BANK_SIZE];		// Stator current Beta, A
+	float	afFrAl[IM_PLANT_BANK_SIZE];		// Rotor flux Alpha, Wb
+	float	afFrBe[IM_PLANT_BANK_SIZE];		// Rotor flux Beta, Wb
+	float	afWrE[IM_PLANT_BANK_SIZE];		// Rotor electrical speed, Rad/Sec
+	float	afTe[IM_PLANT_BANK_SIZE];		// Electromagnetic torque, N*m
+// Functions:
+	int	(*m_init)(struct sIMplantBank*,		// Pointer to initialization function
+			  const tIMparams* IM_RESTRICT);
+	void	(*m_calc)(struct sIMplantBank*,		// Pointer to model function
+			  const tIMparams* IM_RESTRICT, unsigned);
+	void	(*m_rst)(struct sIMplantBank*);		// Pointer to reset function
+} tIMplantBank;
+
+/**
+  * @brief Initialization constant with defaults for "tIMplantBank" user variables
+  *	   (all not listed arrays are initialized with zeros, the supply angle
+  *	   cos are set by m_rst)
+  */
+#define IM_PLANT_BANK_DEFAULTS {		\
+	.fJ		= 0.01f,		\
+	.fB		= 0.0f,			\
+	.fVdivF		= 0.7f,			\
+	.fVboost	= 5.0f,			\
+	.uSub		= 4,			\
+	.m_init		= tIMplantBank_init,	\
+	.m_calc		= tIMplantBank_calc,	\
+	.m_rst		= tIMplantBank_rst	\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* Value of the profile at the given time *****************************************/
+void tIMprofile_get(const tIMprofile*, float, float*, float*);
+
+/* IM plant models bank initialization function prototype **************************/
+int tIMplantBank_init(tIMplantBank*, const tIMparams* IM_RESTRICT);
+
+/* IM plant models bank step (one fDt period) function prototype *******************/
+void tIMplantBank_calc(tIMplantBank*, const tIMparams* IM_RESTRICT, unsigned);
+
+/* Reset the state of IM plant models bank (standstill, zero flux) *****************/
+void tIMplantBank_rst(tIMplantBank*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_PLANT_H__ */
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,514 @@
+/**
+  ***********************************************************************************
+  * @file    im_speed_obs_bank.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware function for implementation the batched
+  *	     (multi-motor) sensorless rotor speed and flux (angle, magnitude)
+  *	     observer with structure-of-arrays data layout.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_speed_obs_bank.h"
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+  * @brief IM parameters used by the observers bank (local copy of "tIMparams")
+  */
+typedef struct sIMbankK
+{
+	float fDt;				// Discretization time, Sec
+	float fHalfDt;				// 0.5*fDt
+	float f1divTr;				// fRr/fLr
+	float f1divKr;				// fLr/fLm
+	float fKrRs;				// fRs*f1divKr
+	float fKrSigLsDivDt;			// fSigLs/fDt*f1divKr
+	float fLmDivTr;				// fLm*f1divTr
+} tIMbankK;
+
+/* Private define -----------------------------------------------------------------*/
+
+/*
+ * SIMD back-end of the linear part of observers, one of (selected at compile
+ * time by the compiler target options, the first available is used):
+ *	IM_BANK_LANES = 16 - x86 AVX-512F;
+ *	IM_BANK_LANES = 8  - x86 AVX/AVX2;
+ *	IM_BANK_LANES = 4  - x86 SSE, ARM NEON (Cortex-A), ARM Helium/MVE (Cortex-M55/M85);
+ *	IM_BANK_LANES = 1  - scalar code only (IM_SPEED_OBS_BANK_NO_SIMD is defined
+ *			     or no supported SIMD extension is available).
+ * Every back-end does the same IEEE-754 operations in the same order as the
+ * scalar reference "tIMspeedObsBank_calcRef", so with disabled contraction of
+ * floating point expressions (-ffp-contract=off) the results are bit-equal.
+ * No division is used (coefficients are precalculated by "tIMparams_init").
+ * IMV_SELLT0(c, a, b) is the lane select (c < 0) ? a : b of "tPID_aw".
+ */
+#if defined(IM_SPEED_OBS_BANK_NO_SIMD)
+#define IM_BANK_LANES		1
+#elif defined(__AVX512F__)
+#include <immintrin.h>
+#define IM_BANK_LANES		16
+#define IMV_T			__m512
+#define IMV_LD(p)		_mm512_loadu_ps(p)
+#define IMV_ST(p, v)		_mm512_storeu_ps((p), (v))
+#define IMV_SET1(x)		_mm512_set1_ps(x)
+#define IMV_ADD(a, b)		_mm512_add_ps((a), (b))
+#define IMV_SUB(a, b)		_mm512_sub_ps((a), (b))
+#define IMV_MUL(a, b)		_mm512_mul_ps((a), (b))
+#define IMV_UPLIM(x, up)	_mm512_min_ps((up), (x))
+#define IMV_LOWLIM(x, low)	_mm512_max_ps((low), (x))
+#define IMV_SELLT0(c, a, b)	_mm512_mask_blend_ps(_mm512_cmp_ps_mask((c),	\
+				_mm512_setzero_ps(), _CMP_LT_OQ), (b), (a))
+#elif defined(__AVX__)
+#include <immintrin.h>
+#define IM_BANK_LANES		8
+#define IMV_T			__m256
+#define IMV_LD(p)		_mm256_loadu_ps(p)
+#define IMV_ST(p, v)		_mm256_storeu_ps((p), (v))
+#define IMV_SET1(x)		_mm256_set1_ps(x)
+#define IMV_ADD(a, b)		_mm256_add_ps((a), (b))
+#define IMV_SUB(a, b)		_mm256_sub_ps((a), (b))
+#define IMV_MUL(a, b)		_mm256_mul_ps((a), (b))
+#define IMV_UPLIM(x, up)	_mm256_min_ps((up), (x))
+#define IMV_LOWLIM(x, low)	_mm256_max_ps((low), (x))
+#define IMV_SELLT0(c, a, b)	_mm256_blendv_ps((b), (a), _mm256_cmp_ps((c),	\
+				_mm256_setzero_ps(), _CMP_LT_OQ))
+#elif defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define IM_BANK_LANES		4
+#define IMV_T			__m128
+#define IMV_LD(p)		_mm_loadu_ps(p)
+#define IMV_ST(p, v)		_mm_storeu_ps((p), (v))
+#define IMV_SET1(x)		_mm_set1_ps(x)
+#define IMV_ADD(a, b)		_mm_add_ps((a), (b))
+#define IMV_SUB(a, b)		_mm_sub_ps((a), (b))
+#define IMV_MUL(a, b)		_mm_mul_ps((a), (b))
+#define IMV_UPLIM(x, up)	_mm_min_ps((up), (x))
+#define IMV_LOWLIM(x, low)	_mm_max_ps((low), (x))
+#define IMV_SELLT0(c, a, b)	_mm_or_ps(_mm_and_ps(_mm_cmplt_ps((c), _mm_setzero_ps()),\
+				(a)), _mm_andnot_ps(_mm_cmplt_ps((c), _mm_setzero_ps()), (b)))
+#elif defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 2)
+#include <arm_mve.h>
+#define IM_BANK_LANES		4
+#define IMV_T			float32x4_t
+#define IMV_LD(p)		vld1q_f32(p)
+#define IMV_ST(p, v)		vst1q_f32((p), (v))
+#define IMV_SET1(x)		vdupq_n_f32(x)
+#define IMV_ADD(a, b)		vaddq_f32((a), (b))
+#define IMV_SUB(a, b)		vsubq_f32((a), (b))
+#define IMV_MUL(a, b)		vmulq_f32((a), (b))
+#define IMV_UPLIM(x, up)	vpselq_f32((up), (x), vcmpgtq_f32((x), (up)))
+#define IMV_LOWLIM(x, low)	vpselq_f32((low), (x), vcmpltq_f32((x), (low)))
+#define IMV_SELLT0(c, a, b)	vpselq_f32((a), (b), vcmpltq_n_f32((c), 0.0f))
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define IM_BANK_LANES		4
+#define IMV_T			float32x4_t
+#define IMV_LD(p)		vld1q_f32(p)
+#define IMV_ST(p, v)		vst1q_f32((p), (v))
+#define IMV_SET1(x)		vdupq_n_f32(x)
+#define IMV_ADD(a, b)		vaddq_f32((a), (b))
+#define IMV_SUB(a, b)		vsubq_f32((a), (b))
+#define IMV_MUL(a, b)		vmulq_f32((a), (b))
+#define IMV_UPLIM(x, up)	vbslq_f32(vcgtq_f32((x), (up)), (up), (x))
+#define IMV_LOWLIM(x, low)	vbslq_f32(vcltq_f32((x), (low)), (low), (x))
+#define IMV_SELLT0(c, a, b)	vbslq_f32(vcltq_f32((c), vdupq_n_f32(0.0f)), (a), (b))
+#else
+#define IM_BANK_LANES		1
+#endif
+
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Copy the IM parameters used by the bank in local data structure.
+  * @param  ptK: pointer to local data structure with type "tIMbankK",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+static inline void tIMbankK_load(tIMbankK* ptK, const tIMparams* IM_RESTRICT ptIMparams)
+{
+	ptK->fDt = ptIMparams->fDt;
+	ptK->fHalfDt = ptIMparams->fHalfDt;
+	ptK->f1divTr = ptIMparams->f1divTr;
+	ptK->f1divKr = ptIMparams->f1divKr;
+	ptK->fKrRs = ptIMparams->fKrRs;
+	ptK->fKrSigLsDivDt = ptIMparams->fKrSigLsDivDt;
+	ptK->fLmDivTr = ptIMparams->fLmDivTr;
+}
+
+/**
+  * @brief  Scalar calculation of the linear part (stator observer, rotor observer
+  *	    and PI-adapter) of the i-th observer of the bank. The operations and
+  *	    their order are the same as in "tIMspeedObs_calc".
+  * @param  ptBank: pointer to user data structure with type "tIMspeedObsBank",
+  *	    ptK: pointer to local data structure with IM parameters,
+  *	    i: index of the observer.
+  * @retval None
+  */
+static inline void tIMspeedObsBank_step(tIMspeedObsBank* ptBank, const tIMbankK* ptK,
+					unsigned i)
+{
+	float fIsAl = ptBank->afIsAl[i];
+	float fIsBe = ptBank->afIsBe[i];
+	float fWrE = ptBank->afWrE[i];
+	float fDiffIsAl, fDiffIsBe, fEsAl, fEsBe, fErAl, fErBe, fFrAl, fFrBe;
+	float fPout, fIout, fPreOut, fOut;
+
+	// stator back-EMF observer
+	fDiffIsAl = fIsAl - ptBank->afPrevIsAl[i];
+	fDiffIsBe = fIsBe - ptBank->afPrevIsBe[i];
+	ptBank->afPrevIsAl[i] = fIsAl;
+	ptBank->afPrevIsBe[i] = fIsBe;
+
+	fEsAl = ptBank->afUsAl[i]*ptK->f1divKr - ptK->fKrRs*fIsAl -
+		ptK->fKrSigLsDivDt*fDiffIsAl;
+	fEsBe = ptBank->afUsBe[i]*ptK->f1divKr - ptK->fKrRs*fIsBe -
+		ptK->fKrSigLsDivDt*fDiffIsBe;
+
+	// rotor back-EMF and flux observer
+	fFrBe = ptBank->afFrBe[i];
+	fErAl = fIsAl*ptK->fLmDivTr - ptBank->afFrAl[i]*ptK->f1divTr - fWrE*fFrBe;
+	fFrAl = ptBank->afFrAl[i] + ptK->fHalfDt*(fErAl + ptBank->afPrevErAl[i]);
+	ptBank->afPrevErAl[i] = fErAl;
+
+	fErBe = fIsBe*ptK->fLmDivTr - fFrBe*ptK->f1divTr + fWrE*fFrAl;
+	fFrBe = fFrBe + ptK->fHalfDt*(fErBe + ptBank->afPrevErBe[i]);
+	ptBank->afPrevErBe[i] = fErBe;
+
+	ptBank->afFrAl[i] = fFrAl;
+	ptBank->afFrBe[i] = fFrBe;
+
+	// PI-adapter of rotor speed
+	fPout = (fIsAl*(fEsBe - fErBe) - fIsBe*(fEsAl - fErAl))*ptBank->afKp[i];
+	fIout = ptBank->afIout[i] + ptK->fHalfDt*(fPout*ptBank->afKi[i] +
+			ptBank->afIprevIn[i]);
+	ptBank->afIprevIn[i] = fPout;
+
+	fPreOut = fPout + fIout;
+	fOut = PID_SATF(fPreOut, ptBank->afLowOutLim[i], ptBank->afUpOutLim[i]);
+
+	ptBank->afIout[i] = tPID_aw(fIout, ptBank->afIout[i], fOut - fPreOut,
+				    ptBank->afAwKaw[i]*ptK->fDt, ptBank->afAwClamp[i]);
+
+	ptBank->afWrE[i] = fOut;
+}
+
+#if IM_BANK_LANES > 1
+/**
+  * @brief  SIMD calculation of the linear part of IM_BANK_LANES observers of the
+  *	    bank starting from the i-th one (same operations as in the scalar
+  *	    "tIMspeedObsBank_step").
+  * @param  ptBank: pointer to user data structure with type "tIMspeedObsBank",
+  *	    ptK: pointer to local data structure with IM parameters,
+  *	    i: index of the first observer.
+  * @retval None
+  */
+static inline void tIMspeedObsBank_stepV(tIMspeedObsBank* ptBank, const tIMbankK* ptK,
+					 unsigned i)
+{
+	const IMV_T vHalfDt = IMV_SET1(ptK->fHalfDt);
+	const IMV_T v1divTr = IMV_SET1(ptK->f1divTr);
+	const IMV_T v1divKr = IMV_SET1(ptK->f1divKr);
+	const IMV_T vKrRs = IMV_SET1(ptK->fKrRs);
+	const IMV_T vKrSigLsDivDt = IMV_SET1(ptK->fKrSigLsDivDt);
+	const IMV_T vLmDivTr = IMV_SET1(ptK->fLmDivTr);
+	IMV_T vIsAl = IMV_LD(&ptBank->afIsAl[i]);
+	IMV_T vIsBe = IMV_LD(&ptBank->afIsBe[i]);
+	IMV_T vWrE = IMV_LD(&ptBank->afWrE[i]);
+	IMV_T vDiffIsAl, vDiffIsBe, vEsAl, vEsBe, vErAl, vErBe, vFrAl, vFrBe;
+	IMV_T vFrAl0, vFrBe0, vPout, vIout, vIprevOut, vPreOut, vOut, vErr;
+
+	// stator back-EMF observer
+	vDiffIsAl = IMV_SUB(vIsAl, IMV_LD(&ptBank->afPrevIsAl[i]));
+	vDiffIsBe = IMV_SUB(vIsBe, IMV_LD(&ptBank->afPrevIsBe[i]));
+	IMV_ST(&ptBank->afPrevIsAl[i], vIsAl);
+	IMV_ST(&ptBank->afPrevIsBe[i], vIsBe);
+
+	vEsAl = IMV_SUB(IMV_SUB(IMV_MUL(IMV_LD(&ptBank->afUsAl[i]), v1divKr),
+				IMV_MUL(vKrRs, vIsAl)), IMV_MUL(vKrSigLsDivDt, vDiffIsAl));
+	vEsBe = IMV_SUB(IMV_SUB(IMV_MUL(IMV_LD(&ptBank->afUsBe[i]), v1divKr),
+				IMV_MUL(vKrRs, vIsBe)), IMV_MUL(vKrSigLsDivDt, vDiffIsBe));
+
+	// rotor back-EMF and flux observer
+	vFrAl0 = IMV_LD(&ptBank->afFrAl[i]);
+	vFrBe0 = IMV_LD(&ptBank->afFrBe[i]);
+	vErAl = IMV_SUB(IMV_SUB(IMV_MUL(vIsAl, vLmDivTr), IMV_MUL(vFrAl0, v1divTr)),
+			IMV_MUL(vWrE, vFrBe0));
+	vFrAl = IMV_ADD(vFrAl0, IMV_MUL(vHalfDt, IMV_ADD(vErAl,
+			IMV_LD(&ptBank->afPrevErAl[i]))));
+	IMV_ST(&ptBank->afPrevErAl[i], vErAl);
+
+	vErBe = IMV_ADD(IMV_SUB(IMV_MUL(vIsBe, vLmDivTr), IMV_MUL(vFrBe0, v1divTr)),
+			IMV_MUL(vWrE, vFrAl));
+	vFrBe = IMV_ADD(vFrBe0, IMV_MUL(vHalfDt, IMV_ADD(vErBe,
+			IMV_LD(&ptBank->afPrevErBe[i]))));
+	IMV_ST(&ptBank->afPrevErBe[i], vErBe);
+
+	IMV_ST(&ptBank->afFrAl[i], vFrAl);
+	IMV_ST(&ptBank->afFrBe[i], vFrBe);
+
+	// PI-adapter of rotor speed
+	vPout = IMV_MUL(IMV_SUB(IMV_MUL(vIsAl, IMV_SUB(vEsBe, vErBe)),
+				IMV_MUL(vIsBe, IMV_SUB(vEsAl, vErAl))),
+			IMV_LD(&ptBank->afKp[i]));
+	vIprevOut = IMV_LD(&ptBank->afIout[i]);
+	vIout = IMV_ADD(vIprevOut, IMV_MUL(vHalfDt, IMV_ADD(
+			IMV_MUL(vPout, IMV_LD(&ptBank->afKi[i])),
+			IMV_LD(&ptBank->afIprevIn[i]))));
+	IMV_ST(&ptBank->afIprevIn[i], vPout);
+
+	vPreOut = IMV_ADD(vPout, vIout);
+	vOut = IMV_UPLIM(vPreOut, IMV_LD(&ptBank->afUpOutLim[i]));
+	vOut = IMV_LOWLIM(vOut, IMV_LD(&ptBank->afLowOutLim[i]));
+
+	// anti-windup (same as "tPID_aw")
+	vErr = IMV_SUB(vOut, vPreOut);
+	vIout = IMV_ADD(vIout, IMV_MUL(IMV_MUL(IMV_LD(&ptBank->afAwKaw[i]),
+			IMV_SET1(ptK->fDt)), vErr));
+	vIout = IMV_SELLT0(IMV_MUL(IMV_MUL(vErr, IMV_SUB(vIout, vIprevOut)),
+			   IMV_LD(&ptBank->afAwClamp[i])), vIprevOut, vIout);
+	IMV_ST(&ptBank->afIout[i], vIout);
+
+	IMV_ST(&ptBank->afWrE[i], vOut);
+}
+#endif /* IM_BANK_LANES > 1 */
+
+/**
+  * @brief  Anti-windup coefficients of the PI-adapters of the bank (from the user
+  *	    settings auAwMode and afKaw, the same as "tPI_init" does).
+  * @param  ptBank: pointer to user data structure with type "tIMspeedObsBank",
+  *	    uNum: count of observers.
+  * @retval None
+  */
+static inline void tIMspeedObsBank_aw(tIMspeedObsBank* ptBank, unsigned uNum)
+{
+	unsigned i;
+
+	for(i = 0; i < uNum; i++)
+	{
+		ptBank->afAwKaw[i] = (ptBank->auAwMode[i] == PID_AW_BACKCALC) ?
+				     ptBank->afKaw[i] : 0.0f;
+		ptBank->afAwClamp[i] = (ptBank->auAwMode[i] == PID_AW_CLAMP) ? 1.0f : 0.0f;
+	}
+}
+
+/**
+  * @brief  Rotor flux angle and magnitude calculation of observers of the bank
+  *	    (accuracy is selected by IM_FAST_MATH).
+  * @param  ptBank: pointer to user data structure with type "tIMspeedObsBank",
+  *	    uNum: count of observers.
+  * @retval None
+  */
+static inline void tIMspeedObsBank_polar(tIMspeedObsBank* ptBank, unsigned uNum)
+{
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+	unsigned i;
+
+	for(i = 0; i < uNum; i++)
+		imPolarf(ptBank->afFrBe[i], ptBank->afFrAl[i], &ptBank->afFrAng[i],
+			 &ptBank->afFrMagn[i]);
+#else
+	(void)ptBank;
+	(void)uNum;
+#endif
+}
+
+/**
+  * @brief  IM rotor speed and flux observers bank calculation function. Every
+  *	    observer does exactly the same operations (in the same order) as
+  *	    "tIMspeedObs_calc" with "sPI.fDtSec" equal to "fDt" of IM parameters.
+  *	    IM_BANK_LANES observers are calculated by one SIMD instruction.
+  * @param  ptBank: pointer to user data structure with type "tIMspeedObsBank",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    uNum: count of observers to calculate (from the first one).
+  * @retval None
+  */
+void tIMspeedObsBank_calc(tIMspeedObsBank* ptBank,
+			  const tIMparams* IM_RESTRICT ptIMparams, unsigned uNum)
+{
+	tIMbankK sK;
+	unsigned i = 0;
+
+	if(uNum > IM_SPEED_OBS_BANK_SIZE) uNum = IM_SPEED_OBS_BANK_SIZE;
+
+	tIMbankK_load(&sK, ptIMparams);
+	tIMspeedObsBank_aw(ptBank, uNum);
+
+#if IM_BANK_LANES > 1
+	for(; i + IM_BANK_LANES <= uNum; i += IM_BANK_LANES)
+		tIMspeedObsBank_stepV(ptBank, &sK, i);
+#endif
+	for(; i < uNum; i++)
+		tIMspeedObsBank_step(ptBank, &sK, i);
+
+	tIMspeedObsBank_polar(ptBank, uNum);
+}
+
+/**
+  * @brief  Index of the IM parameters set of the i-th observer of the bank (out of
+  *	    the table indexes select the first set).
+  * @param  ptBank: pointer to user data structure with type "tIMspeedObsBank",
+  *	    uParams: count of IM parameters sets in the table,
+  *	    i: index of the observer.
+  * @retval Index of the IM parameters set.
+  */
+static inline unsigned tIMspeedObsBank_param(const tIMspeedObsBank* ptBank,
+					     unsigned uParams, unsigned i)
+{
+	unsigned uIdx = ptBank->auParams[i];
+
+	return (uIdx < uParams) ? uIdx : 0;
+}
+
+/**
+  * @brief  IM rotor speed and flux observers bank calculation function with the
+  *	    table of shared IM parameters sets (e.g. the axes of the same motor
+  *	    type refer to one set): the i-th observer uses the set "auParams[i]"
+  *	    of the table. The coefficients are loaded only when the set changes,
+  *	    IM_BANK_LANES observers with the same set are calculated by one SIMD
+  *	    instruction (order the observers by the set index for the best
+  *	    performance). With all indexes equal the results are the same as of
+  *	    "tIMspeedObsBank_calc" with this set.
+  * @param  ptBank: pointer to user data structure with type "tIMspeedObsBank",
+  *	    ptTab: pointer to the table of IM parameters sets (initialized),
+  *	    uParams: count of IM parameters sets in the table,
+  *	    uNum: count of observers to calculate (from the first one).
+  * @retval None
+  */
+void tIMspeedObsBank_calcTab(tIMspeedObsBank* ptBank, const tIMparams* IM_RESTRICT ptTab,
+			     unsigned uParams, unsigned uNum)
+{
+	tIMbankK sK;
+	unsigned i = 0, uIdx, uLoaded;
+
+	if(uNum > IM_SPEED_OBS_BANK_SIZE) uNum = IM_SPEED_OBS_BANK_SIZE;
+	if(uParams == 0) return;
+
+	// the set of the first observer is loaded before the loops
+	uLoaded = tIMspeedObsBank_param(ptBank, uParams, 0);
+	tIMbankK_load(&sK, &ptTab[uLoaded]);
+	tIMspeedObsBank_aw(ptBank, uNum);
+
+#if IM_BANK_LANES > 1
+	for(; i + IM_BANK_LANES <= uNum; i += IM_BANK_LANES)
+	{
+		unsigned l = 1;
+
+		uIdx = tIMspeedObsBank_param(ptBank, uParams, i);
+		while((l < IM_BANK_LANES) && (tIMspeedObsBank_param(ptBank, uParams, i + l) ==
+					      uIdx)) l++;
+
+		if(l == IM_BANK_LANES)		// one set of the SIMD lanes
+		{
+			if(uIdx != uLoaded) tIMbankK_load(&sK, &ptTab[uLoaded = uIdx]);
+			tIMspeedObsBank_stepV(ptBank, &sK, i);
+			continue;
+		}
+		for(l = 0; l < IM_BANK_LANES; l++)
+		{
+			uIdx = tIMspeedObsBank_param(ptBank, uParams, i + l);
+			if(uIdx != uLoaded) tIMbankK_load(&sK, &ptTab[uLoaded = uIdx]);
+			tIMspeedObsBank_step(ptBank, &sK, i + l);
+		}
+	}
+#endif
+	for(; i < uNum; i++)
+	{
+		uIdx = tIMspeedObsBank_param(ptBank, uParams, i);
+		if(uIdx != uLoaded) tIMbankK_load(&sK, &ptTab[uLoaded = uIdx]);
+		tIMspeedObsBank_step(ptBank, &sK, i);
+	}
+
+	tIMspeedObsBank_polar(ptBank, uNum);
+}
+
+/**
+  * @brief  Scalar reference implementation of "tIMspeedObsBank_calc" (no SIMD
+  *	    instructions are used explicitly) for results comparison.
+  * @param  ptBank: pointer to user data structure with type "tIMspeedObsBank",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams",
+  *	    uNum: count of observers to calculate (from the first one).
+  * @retval None
+  */
+void tIMspeedObsBank_calcRef(tIMspeedObsBank* ptBank,
+			     const tIMparams* IM_RESTRICT ptIMparams, unsigned uNum)
+{
+	tIMbankK sK;
+	unsigned i;
+
+	if(uNum > IM_SPEED_OBS_BANK_SIZE) uNum = IM_SPEED_OBS_BANK_SIZE;
+
+	tIMbankK_load(&sK, ptIMparams);
+	tIMspeedObsBank_aw(ptBank, uNum);
+
+	for(i = 0; i < uNum; i++)
+		tIMspeedObsBank_step(ptBank, &sK, i);
+
+	tIMspeedObsBank_polar(ptBank, uNum);
+}
+
+/**
+  * @brief  Count of observers calculated by one SIMD instruction.
+  * @param  None
+  * @retval Count of SIMD lanes (1 - scalar implementation only).
+  */
+unsigned tIMspeedObsBank_lanes(void)
+{
+	return IM_BANK_LANES;
+}
+
+/**
+  * @brief  Reset the internal variables and outputs of all observers of the bank.
+  * @param  ptBank: pointer to user data structure with type "tIMspeedObsBank".
+  * @retval None
+  */
+void tIMspeedObsBank_rst(tIMspeedObsBank* ptBank)
+{
+	unsigned i;
+
+	for(i = 0; i < IM_SPEED_OBS_BANK_SIZE; i++)
+	{
+		ptBank->afPrevIsAl[i] = 0.0f;
+		ptBank->afPrevIsBe[i] = 0.0f;
+		ptBank->afPrevErAl[i] = 0.0f;
+		ptBank->afPrevErBe[i] = 0.0f;
+		ptBank->afFrAl[i] = 0.0f;
+		ptBank->afFrBe[i] = 0.0f;
+		ptBank->afIprevIn[i] = 0.0f;
+		ptBank->afIout[i] = 0.0f;
+		ptBank->afWrE[i] = 0.0f;
+		ptBank->afFrAng[i] = 0.0f;
+		ptBank->afFrMagn[i] = 0.0f;
+	}
+}
+
+/*********************************** END OF FILE ***********************************/
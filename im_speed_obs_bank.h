@@ -0,0 +1,140 @@
+/**
+  ***********************************************************************************
+  * @file    im_speed_obs_bank.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the batched (multi-motor) induction
+  *	     motor (IM) rotor speed and flux observer with structure-of-arrays
+  *	     data layout.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_SPEED_OBS_BANK_H__
+#define __IM_SPEED_OBS_BANK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators.h" // Induction Motor estimators library
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Max count of observers (motors) stored in one "tIMspeedObsBank" variable,
+  *	   can be overridden by the user at compile time. Define the
+  *	   IM_SPEED_OBS_BANK_NO_SIMD to disable the SIMD back-ends.
+  */
+#ifndef IM_SPEED_OBS_BANK_SIZE
+#define IM_SPEED_OBS_BANK_SIZE	16
+#endif
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "IM sensorless rotor speed & flux observers Bank Module" data structure.
+  *	   Every array element [i] holds the data of the i-th observer (motor),
+  *	   the math of every observer is the same as in "tIMspeedObs" (with
+  *	   "tPI_calc" PI-adapter, saturation and anti-windup included).
+  */
+typedef struct sIMspeedObsBank
+{
+// Inputs:
+	float	afUsAl[IM_SPEED_OBS_BANK_SIZE];		// Stator voltage Alpha, Volts
+	float	afUsBe[IM_SPEED_OBS_BANK_SIZE];		// Stator voltage Beta, Volts
+	float	afIsAl[IM_SPEED_OBS_BANK_SIZE];		// Stator current Alpha, A
+	float	afIsBe[IM_SPEED_OBS_BANK_SIZE];		// Stator current Beta, A
+	float	afKp[IM_SPEED_OBS_BANK_SIZE];		// PI-adapter proportional coef.
+	float	afKi[IM_SPEED_OBS_BANK_SIZE];		// PI-adapter integral coef.
+	float	afUpOutLim[IM_SPEED_OBS_BANK_SIZE];	// PI-adapter output upper limit
+	float	afLowOutLim[IM_SPEED_OBS_BANK_SIZE];	// PI-adapter output lower limit
+	unsigned auAwMode[IM_SPEED_OBS_BANK_SIZE];	// PI-adapter anti-windup mode
+							// (PID_AW_...)
+	float	afKaw[IM_SPEED_OBS_BANK_SIZE];		// PI-adapter back-calculation gain,
+							// 1/Sec
+	unsigned auParams[IM_SPEED_OBS_BANK_SIZE];	// Index of IM parameters set in the
+							// table ("tIMspeedObsBank_calcTab")
+// Internal variables:
+	float	afAwKaw[IM_SPEED_OBS_BANK_SIZE];	// afKaw (PID_AW_BACKCALC) or 0
+	float	afAwClamp[IM_SPEED_OBS_BANK_SIZE];	// 1 (PID_AW_CLAMP) or 0
+	float	afPrevIsAl[IM_SPEED_OBS_BANK_SIZE];	// Previous stator current Alpha, A
+	float	afPrevIsBe[IM_SPEED_OBS_BANK_SIZE];	// Previous stator current Beta, A
+	float	afPrevErAl[IM_SPEED_OBS_BANK_SIZE];	// Previous rotor back-EMF Alpha, Volts
+	float	afPrevErBe[IM_SPEED_OBS_BANK_SIZE];	// Previous rotor back-EMF Beta, Volts
+	float	afFrAl[IM_SPEED_OBS_BANK_SIZE];		// Rotor flux Alpha, Wb
+	float	afFrBe[IM_SPEED_OBS_BANK_SIZE];		// Rotor flux Beta, Wb
+	float	afIprevIn[IM_SPEED_OBS_BANK_SIZE];	// PI-adapter integral link's
+							// previous input
+	float	afIout[IM_SPEED_OBS_BANK_SIZE];		// PI-adapter integral link's output
+// Outputs:
+	float	afWrE[IM_SPEED_OBS_BANK_SIZE];		// Rotor electrical speed, Rad/Sec
+	float	afFrAng[IM_SPEED_OBS_BANK_SIZE];	// Rotor flux angle, Rad
+	float	afFrMagn[IM_SPEED_OBS_BANK_SIZE];	// Rotor flux magnitude, Wb
+// Functions:
+	void	(*m_calc)(struct sIMspeedObsBank*,	// Pointer to estimator function
+			  const tIMparams* IM_RESTRICT, unsigned);
+	void	(*m_rst)(struct sIMspeedObsBank*);	// Pointer to reset function
+} tIMspeedObsBank;
+
+/**
+  * @brief Initialization constant with defaults for "tIMspeedObsBank" user variables
+  *	   (all not listed arrays are initialized with zeros)
+  */
+#define IM_SPEED_OBS_BANK_DEFAULTS {		\
+	.m_calc		= tIMspeedObsBank_calc,	\
+	.m_rst		= tIMspeedObsBank_rst	\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* IM rotor speed and flux observers bank function prototype ***********************/
+void tIMspeedObsBank_calc(tIMspeedObsBank*, const tIMparams* IM_RESTRICT, unsigned);
+
+/* IM rotor speed and flux observers bank with the table of IM parameters *********/
+void tIMspeedObsBank_calcTab(tIMspeedObsBank*, const tIMparams* IM_RESTRICT, unsigned,
+			     unsigned);
+
+/* Scalar reference of IM rotor speed and flux observers bank function prototype ***/
+void tIMspeedObsBank_calcRef(tIMspeedObsBank*, const tIMparams* IM_RESTRICT, unsigned);
+
+/* Count of observers calculated by one SIMD instruction ***************************/
+unsigned tIMspeedObsBank_lanes(void);
+
+/* Reset the internal variables of IM rotor speed and flux observers bank **********/
+void tIMspeedObsBank_rst(tIMspeedObsBank*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_SPEED_OBS_BANK_H__ */
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,223 @@
+/**
+  ***********************************************************************************
+  * @file    im_startup.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the startup
+  *	     identification of the induction motor speed observer state:
+  *		+ pre-magnetization and catch-on-the-fly sequences;
+  *		+ convergence test and seeding of the speed observer.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_startup.h"
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Restart the startup sequence (the convergence flag is cleared).
+  * @param  ptIMstartup: pointer to user data structure with type "tIMstartup".
+  * @retval None
+  */
+void tIMstartup_init(tIMstartup* ptIMstartup)
+{
+	if(ptIMstartup->uWin == 0) ptIMstartup->uWin = 1;
+	
+	ptIMstartup->fFvAl = ptIMstartup->fFvBe = 0.0f;
+	ptIMstartup->fSumWs = ptIMstartup->fSumEs2 = 0.0f;
+	ptIMstartup->fSumSlA = ptIMstartup->fSumSlB = 0.0f;
+	ptIMstartup->fPrevWrE = 0.0f;
+	ptIMstartup->uCnt = 0;
+	ptIMstartup->uWins = 0;
+	
+	ptIMstartup->uDone = 0;
+	ptIMstartup->uSteps = 0;
+	ptIMstartup->fWrE = 0.0f;
+	ptIMstartup->fFrAl = ptIMstartup->fFrBe = 0.0f;
+}
+
+/**
+  * @brief  Pre-magnetization step: the rotor observer at the zero speed, the speed
+  *	    observer outputs follow the flux (the PI-adapter is not calculated).
+  * @param  ptIMstartup: pointer to user data structure with type "tIMstartup",
+  *	    ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval Non-zero when converged.
+  */
+static int tIMstartup_premag(tIMstartup* ptIMstartup, tIMspeedObs* ptIMspeedObs,
+			     const tIMparams* IM_RESTRICT ptIMparams)
+{
+	tIMrotObs* ptRot = &ptIMspeedObs->sIMrotObs;
+	float fErrAl, fErrBe, fRefAl, fRefBe, fRef2;
+	
+	ptRot->fIsAl = ptIMspeedObs->fIsAl;
+	ptRot->fIsBe = ptIMspeedObs->fIsBe;
+	ptRot->fWrE = 0.0f;
+	ptRot->m_calc(ptRot, ptIMparams);
+	
+	ptIMstartup->fWrE = 0.0f;
+	ptIMstartup->fFrAl = ptRot->fFrAl;
+	ptIMstartup->fFrBe = ptRot->fFrBe;
+	
+	ptIMspeedObs->fWrE = 0.0f;
+	imPolarf(ptRot->fFrBe, ptRot->fFrAl, &ptIMspeedObs->fFrAng,
+		 &ptIMspeedObs->fFrMagn);
+	if(ptIMspeedObs->fFrMagn > 0.0f)
+	{
+		float f1divMagn = 1.0f/ptIMspeedObs->fFrMagn;
+		
+		ptIMspeedObs->fFrCos = ptRot->fFrAl*f1divMagn;
+		ptIMspeedObs->fFrSin = ptRot->fFrBe*f1divMagn;
+	}
+	
+	// steady state of the standstill rotor: Fr = fLm*Is
+	fRefAl = ptIMparams->fLm*ptRot->fIsAl;
+	fRefBe = ptIMparams->fLm*ptRot->fIsBe;
+	fErrAl = fRefAl - ptRot->fFrAl;
+	fErrBe = fRefBe - ptRot->fFrBe;
+	fRef2 = fRefAl*fRefAl + fRefBe*fRefBe;
+	
+	if((fRef2 > 0.0f) && (fErrAl*fErrAl + fErrBe*fErrBe <=
+			      ptIMstartup->fTolFr*ptIMstartup->fTolFr*fRef2))
+		ptIMstartup->uCnt++;
+	else
+		ptIMstartup->uCnt = 0;
+	
+	return ptIMstartup->uCnt >= ptIMstartup->uWin;
+}
+
+/**
+  * @brief  Catch-on-the-fly step: the low-pass integration of the stator back-EMF
+  *	    Fv = Es/(j*Ws + fWc), the flux frequency Ws = (Fv x Es)/|Fv|^2 and
+  *	    the slip components are averaged over the window. At the end of the
+  *	    window the flux is compensated Fr = Fv*(1 - j*fWc/Ws) and the speed
+  *	    is Wr = Ws - fLmDivTr*(Fr x Is)/|Fr|^2.
+  * @param  ptIMstartup: pointer to user data structure with type "tIMstartup",
+  *	    ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval Non-zero when converged.
+  */
+static int tIMstartup_catch(tIMstartup* ptIMstartup, tIMspeedObs* ptIMspeedObs,
+			    const tIMparams* IM_RESTRICT ptIMparams)
+{
+	float fEsAl = ptIMspeedObs->sIMstatObs.fEsAl;
+	float fEsBe = ptIMspeedObs->sIMstatObs.fEsBe;
+	float fIsAl = ptIMspeedObs->fIsAl;
+	float fIsBe = ptIMspeedObs->fIsBe;
+	float fFvAl = ptIMstartup->fFvAl;
+	float fFvBe = ptIMstartup->fFvBe;
+	float f1divFv2 = 1.0f/(fFvAl*fFvAl + fFvBe*fFvBe + 1.0e-30f);
+	float fLeak = 1.0f - ptIMstartup->fWc*ptIMparams->fDt;
+	float f1divWin, fWs, fK, fSl, fWr;
+	int iConv;
+	
+	ptIMstartup->fSumWs += (fFvAl*fEsBe - fFvBe*fEsAl)*f1divFv2;
+	ptIMstartup->fSumSlA += (fFvAl*fIsBe - fFvBe*fIsAl)*f1divFv2;
+	ptIMstartup->fSumSlB += (fFvAl*fIsAl + fFvBe*fIsBe)*f1divFv2;
+	ptIMstartup->fSumEs2 += fEsAl*fEsAl + fEsBe*fEsBe;
+	
+	fFvAl = ptIMstartup->fFvAl = fLeak*fFvAl + ptIMparams->fDt*fEsAl;
+	fFvBe = ptIMstartup->fFvBe = fLeak*fFvBe + ptIMparams->fDt*fEsBe;
+	
+	if(++ptIMstartup->uCnt < ptIMstartup->uWin) return 0;
+	
+	// end of the window: compensation of the low-pass integrator and the slip
+	f1divWin = 1.0f/(float)ptIMstartup->uWin;
+	fWs = ptIMstartup->fSumWs*f1divWin;
+	fK = ptIMstartup->fWc*fWs/(fWs*fWs + 1.0e-6f);	// fWc/Ws
+	fSl = ptIMparams->fLmDivTr*(ptIMstartup->fSumSlA + fK*ptIMstartup->fSumSlB)*
+	      f1divWin/(1.0f + fK*fK);
+	fWr = fWs - fSl;
+	
+	ptIMstartup->fFrAl = fFvAl + fK*fFvBe;
+	ptIMstartup->fFrBe = fFvBe - fK*fFvAl;
+	ptIMstartup->fWrE = fWr;
+	
+	iConv = (ptIMstartup->uWins > 0) &&
+		(fabsf(fWr - ptIMstartup->fPrevWrE) <= ptIMstartup->fTolW) &&
+		(ptIMstartup->fSumEs2*f1divWin >= ptIMstartup->fEsMin*ptIMstartup->fEsMin);
+	
+	ptIMstartup->fPrevWrE = fWr;
+	ptIMstartup->uWins++;
+	ptIMstartup->uCnt = 0;
+	ptIMstartup->fSumWs = ptIMstartup->fSumEs2 = 0.0f;
+	ptIMstartup->fSumSlA = ptIMstartup->fSumSlB = 0.0f;
+	
+	return iConv;
+}
+
+/**
+  * @brief  Step of the startup sequence (call instead of the speed observer m_calc
+  *	    with the same inputs fUsAl, fUsBe, fIsAl, fIsBe of the speed observer).
+  *	    The stator observer runs at every step, at the convergence the speed
+  *	    observer is seeded by the identified speed and flux and uDone is set,
+  *	    after that the calls are forwarded to the speed observer m_calc.
+  * @param  ptIMstartup: pointer to user data structure with type "tIMstartup",
+  *	    ptIMspeedObs: pointer to user data structure with type "tIMspeedObs",
+  *	    ptIMparams: pointer to user data structure with type "tIMparams".
+  * @retval None
+  */
+void tIMstartup_calc(tIMstartup* ptIMstartup, tIMspeedObs* ptIMspeedObs,
+		     const tIMparams* IM_RESTRICT ptIMparams)
+{
+	tIMstatObs* ptStat = &ptIMspeedObs->sIMstatObs;
+	int iConv;
+	
+	if(ptIMstartup->uDone)
+	{
+		ptIMspeedObs->m_calc(ptIMspeedObs, ptIMparams);
+		return;
+	}
+	ptIMstartup->uSteps++;
+	
+	ptStat->fUsAl = ptIMspeedObs->fUsAl;
+	ptStat->fUsBe = ptIMspeedObs->fUsBe;
+	ptStat->fIsAl = ptIMspeedObs->fIsAl;
+	ptStat->fIsBe = ptIMspeedObs->fIsBe;
+	ptStat->m_calc(ptStat, ptIMparams);
+	
+	if(ptIMstartup->uMode == IM_STARTUP_CATCH)
+		iConv = tIMstartup_catch(ptIMstartup, ptIMspeedObs, ptIMparams);
+	else
+		iConv = tIMstartup_premag(ptIMstartup, ptIMspeedObs, ptIMparams);
+	
+	if(iConv)
+	{
+		tIMspeedObs_seed(ptIMspeedObs, ptIMparams, ptIMstartup->fWrE,
+				 ptIMstartup->fFrAl, ptIMstartup->fFrBe);
+		ptIMstartup->uDone = 1;
+	}
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,147 @@
+/**
+  ***********************************************************************************
+  * @file    im_startup.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the startup identification of the
+  *	     induction motor (IM) rotor speed and flux observer state:
+  *		+ pre-magnetization (standstill rotor, the flux build-up by the
+  *		  rotor model at the zero speed);
+  *		+ catch-on-the-fly (rotating rotor, the speed and flux by the
+  *		  stator back-EMF);
+  *		+ seeding of the speed observer with the convergence flag.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_STARTUP_H__
+#define __IM_STARTUP_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators.h" // Induction Motor estimators library
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Startup sequences of "tIMstartup" (uMode):
+  *	   IM_STARTUP_PREMAG - pre-magnetization of the standstill rotor: the
+  *			       rotor observer runs at the zero speed (PI-adapter
+  *			       is held), converged when the flux is within fTolFr
+  *			       of the steady state fLm*Is during uWin steps;
+  *	   IM_STARTUP_CATCH  - catch-on-the-fly of the rotating rotor (residual
+  *			       flux with the measured stator voltage, or any
+  *			       current of the drive): the rotor flux is the stator
+  *			       back-EMF integrated by the low-pass filter (fWc)
+  *			       with the gain/phase compensation at the flux
+  *			       frequency, the rotor speed is the flux frequency
+  *			       minus the slip of the rotor model, converged when
+  *			       the averages of two consecutive windows of uWin
+  *			       steps are within fTolW and the back-EMF RMS is
+  *			       above fEsMin.
+  */
+#define IM_STARTUP_PREMAG	0
+#define IM_STARTUP_CATCH	1
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "IM speed observer startup identification Module" data structure. The
+  *	   sequence uses the inputs (fUsAl, fUsBe, fIsAl, fIsBe) and the stator
+  *	   and rotor observers of the speed observer, at the convergence the
+  *	   observer is seeded ("tIMspeedObs_seed") and the next m_calc calls are
+  *	   forwarded to the observer m_calc.
+  */
+typedef struct sIMstartup
+{
+// Inputs:
+	unsigned	uMode;			// Sequence (IM_STARTUP_...)
+	unsigned	uWin;			// Steps of the convergence window
+	float		fTolFr;			// Pre-magnetization: relative tolerance
+						// of the flux steady state
+	float		fTolW;			// Catch: speed tolerance, Rad/Sec
+	float		fEsMin;			// Catch: min back-EMF RMS, Volts
+	float		fWc;			// Catch: cutoff of the flux low-pass
+						// integrator, Rad/Sec
+// Internal variables:
+	float		fFvAl;			// Low-pass integrated back-EMF Alpha, Wb
+	float		fFvBe;			// Low-pass integrated back-EMF Beta, Wb
+	float		fSumWs;			// Window sum of the flux frequency
+	float		fSumSlA;		// Window sum of the slip components
+	float		fSumSlB;		//   (cross and dot of Fv, Is)/|Fv|^2
+	float		fSumEs2;		// Window sum of |Es|^2
+	float		fPrevWrE;		// Speed of the previous window, Rad/Sec
+	unsigned	uCnt;			// Steps counter of the window
+	unsigned	uWins;			// Count of completed windows
+// Outputs:
+	unsigned	uDone;			// Converged and the observer is seeded
+	unsigned	uSteps;			// Count of steps of the sequence
+	float		fWrE;			// Identified rotor electrical speed,
+						// Rad/Sec
+	float		fFrAl;			// Identified rotor flux Alpha, Wb
+	float		fFrBe;			// Identified rotor flux Beta, Wb
+// Functions:
+	void	(*m_init)(struct sIMstartup*);	// Pointer to (re)start function
+	void	(*m_calc)(struct sIMstartup*,	// Pointer to sequence step function
+			  tIMspeedObs*, const tIMparams* IM_RESTRICT);
+} tIMstartup;
+
+/**
+  * @brief Initialization constant with defaults for "tIMstartup" user variables
+  *	   (all not listed variables are initialized with zeros)
+  */
+#define IM_STARTUP_DEFAULTS {			\
+	.uMode		= IM_STARTUP_PREMAG,	\
+	.uWin		= 100,			\
+	.fTolFr		= 0.02f,		\
+	.fTolW		= 0.5f,			\
+	.fEsMin		= 1.0f,			\
+	.fWc		= 100.0f,		\
+	.m_init		= tIMstartup_init,	\
+	.m_calc		= tIMstartup_calc	\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* IM speed observer startup (re)start function prototype **************************/
+void tIMstartup_init(tIMstartup*);
+
+/* IM speed observer startup sequence step function prototype *********************/
+void tIMstartup_calc(tIMstartup*, tIMspeedObs*, const tIMparams* IM_RESTRICT);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_STARTUP_H__ */
+
+/*********************************** END OF FILE ***********************************/
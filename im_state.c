@@ -0,0 +1,382 @@
+/**
+  ***********************************************************************************
+  * @file    im_state.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the state
+  *	     snapshots of the estimators, P/I/D controllers and IM model:
+  *		+ state descriptors of the types (contiguous ranges of fields);
+  *		+ snapshot save and restore with the layout and checksum check.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_state.h"
+#include <string.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/* Size of the header is a part of the format **************************************/
+typedef char tIMstateHdrSizeCheck[(sizeof(tIMstateHdr) == 24) ? 1 : -1];
+
+/* Private define -----------------------------------------------------------------*/
+#define IM_STATE_FNV_BASIS	2166136261u	// FNV-1a offset basis
+#define IM_STATE_FNV_PRIME	16777619u	// FNV-1a prime
+#define IM_STATE_LANES		4		// Lanes of the payload checksum
+
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+
+/**
+  * @brief Contiguous range of the state variables from "first" to "last" member of
+  *	   the type "t" (including the padding between members).
+  */
+#define IM_STATE_RANGE(t, first, last)	{				\
+	(uint32_t)offsetof(t, first),					\
+	(uint32_t)(offsetof(t, last) + sizeof(((t*)0)->last) - offsetof(t, first)) }
+
+/**
+  * @brief Descriptor of the type "t" with the fields table "fields"
+  */
+#define IM_STATE_DESC(type, ver, t, fields)	{			\
+	type, ver, (uint32_t)sizeof(t),					\
+	(unsigned)(sizeof(fields)/sizeof(fields[0])), fields }
+
+/**
+  * @brief State fields of the nested objects ("m" - member prefix with the trailing
+  *	   dot, empty for the object itself)
+  */
+#define IM_STATE_PI_FIELDS(t, m)					\
+	IM_STATE_RANGE(t, m fPout, m fOut)
+
+#define IM_STATE_SPEED_OBS_FIELDS(t, m)					\
+	IM_STATE_RANGE(t, m sIMstatObs.fPrevIsAl, m sIMstatObs.fEsBe),	\
+	IM_STATE_RANGE(t, m sIMrotObs.fPrevErAl, m sIMrotObs.fErBe),	\
+	IM_STATE_PI_FIELDS(t, m sPI.),					\
+	IM_STATE_RANGE(t, m uDecimCnt, m uDecimCnt),			\
+	IM_STATE_RANGE(t, m fFrAngSub, m fFrAngStep),			\
+	IM_STATE_RANGE(t, m uAngTrackCnt, m uAngTrackCnt),		\
+	IM_STATE_RANGE(t, m fWrE, m fFrSin)
+
+#define IM_STATE_SPEED_OBS_FX_FIELDS(t)					\
+	IM_STATE_RANGE(t, sIMstatObs.qPrevIsAl, sIMstatObs.qEsBe),	\
+	IM_STATE_RANGE(t, sIMrotObs.qPrevErAl, sIMrotObs.qErBe),	\
+	IM_STATE_RANGE(t, sPI.qPout, sPI.qOut),				\
+	IM_STATE_RANGE(t, qWrE, qFrMagn)
+
+/* Private variables --------------------------------------------------------------*/
+
+/* State fields of the types *******************************************************/
+static const tIMstateField asIMstatePI[] = { IM_STATE_PI_FIELDS(tPI, ) };
+static const tIMstateField asIMstatePD[] = { IM_STATE_RANGE(tPD, fPout, fOut) };
+static const tIMstateField asIMstatePID[] = { IM_STATE_RANGE(tPID, fPout, fOut) };
+static const tIMstateField asIMstatePIDbank[] = {
+	IM_STATE_RANGE(tPIDbank, afPrevPout, afOut)
+};
+static const tIMstateField asIMstatePIq31[] = { IM_STATE_RANGE(tPIq31, qPout, qOut) };
+static const tIMstateField asIMstatePIDq31[] = { IM_STATE_RANGE(tPIDq31, qPout, qOut) };
+static const tIMstateField asIMstatePIq15[] = { IM_STATE_RANGE(tPIq15, qPout, qOut) };
+static const tIMstateField asIMstatePIDq15[] = { IM_STATE_RANGE(tPIDq15, qPout, qOut) };
+static const tIMstateField asIMstateStatObs[] = {
+	IM_STATE_RANGE(tIMstatObs, fPrevIsAl, fEsBe)
+};
+static const tIMstateField asIMstateRotObs[] = {
+	IM_STATE_RANGE(tIMrotObs, fPrevErAl, fErBe)
+};
+static const tIMstateField asIMstateSpeedObs[] = {
+	IM_STATE_SPEED_OBS_FIELDS(tIMspeedObs, )
+};
+static const tIMstateField asIMstateSpeedObsBank[] = {
+	IM_STATE_RANGE(tIMspeedObsBank, afPrevIsAl, afFrMagn)
+};
+static const tIMstateField asIMstateSpeedObsQ31[] = {
+	IM_STATE_SPEED_OBS_FX_FIELDS(tIMspeedObsQ31)
+};
+static const tIMstateField asIMstateSpeedObsQ15[] = {
+	IM_STATE_SPEED_OBS_FX_FIELDS(tIMspeedObsQ15)
+};
+static const tIMstateField asIMstateEkf[] = { IM_STATE_RANGE(tIMekf, fXIsAl, fFrMagn) };
+static const tIMstateField asIMstateFluxObs[] = {
+	IM_STATE_RANGE(tIMfluxObs, fXIsAl, fXIsBe),
+	IM_STATE_PI_FIELDS(tIMfluxObs, sPI.),
+	IM_STATE_RANGE(tIMfluxObs, fFrAl, fFrMagn)
+};
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+static const tIMstateField asIMstateFoc[] = {
+	IM_STATE_SPEED_OBS_FIELDS(tIMfoc, sIMspeedObs.),
+	IM_STATE_PI_FIELDS(tIMfoc, sPId.),
+	IM_STATE_PI_FIELDS(tIMfoc, sPIq.),
+	IM_STATE_RANGE(tIMfoc, fId, fDutyC)
+};
+#endif
+static const tIMstateField asIMstatePlantBank[] = {
+	IM_STATE_RANGE(tIMplantBank, afSupCos, afTe)
+};
+static const tIMstateField asIMstateParamsEst[] = {
+	IM_STATE_RANGE(tIMparamsEst, asAcc, uAcc),
+	IM_STATE_RANGE(tIMparamsEst, fRs, uUpdates)
+};
+static const tIMstateField asIMstateStartup[] = {
+	IM_STATE_RANGE(tIMstartup, fFvAl, fFrBe)
+};
+
+/* Exported variables -------------------------------------------------------------*/
+
+/* State descriptors of the types **************************************************/
+const tIMstateDesc sIMstatePI = IM_STATE_DESC(IM_STATE_P_I, 1, tPI, asIMstatePI);
+const tIMstateDesc sIMstatePD = IM_STATE_DESC(IM_STATE_P_D, 1, tPD, asIMstatePD);
+const tIMstateDesc sIMstatePID = IM_STATE_DESC(IM_STATE_PID, 1, tPID, asIMstatePID);
+const tIMstateDesc sIMstatePIDbank = IM_STATE_DESC(IM_STATE_PID_BANK, 1, tPIDbank,
+						   asIMstatePIDbank);
+const tIMstateDesc sIMstatePIq31 = IM_STATE_DESC(IM_STATE_PI_Q31, 1, tPIq31,
+						 asIMstatePIq31);
+const tIMstateDesc sIMstatePIDq31 = IM_STATE_DESC(IM_STATE_PID_Q31, 1, tPIDq31,
+						  asIMstatePIDq31);
+const tIMstateDesc sIMstatePIq15 = IM_STATE_DESC(IM_STATE_PI_Q15, 1, tPIq15,
+						 asIMstatePIq15);
+const tIMstateDesc sIMstatePIDq15 = IM_STATE_DESC(IM_STATE_PID_Q15, 1, tPIDq15,
+						  asIMstatePIDq15);
+const tIMstateDesc sIMstateStatObs = IM_STATE_DESC(IM_STATE_STAT_OBS, 1, tIMstatObs,
+						   asIMstateStatObs);
+const tIMstateDesc sIMstateRotObs = IM_STATE_DESC(IM_STATE_ROT_OBS, 1, tIMrotObs,
+						  asIMstateRotObs);
+const tIMstateDesc sIMstateSpeedObs = IM_STATE_DESC(IM_STATE_SPEED_OBS, 1, tIMspeedObs,
+						    asIMstateSpeedObs);
+const tIMstateDesc sIMstateSpeedObsBank = IM_STATE_DESC(IM_STATE_SPEED_OBS_BANK, 1,
+							tIMspeedObsBank,
+							asIMstateSpeedObsBank);
+const tIMstateDesc sIMstateSpeedObsQ31 = IM_STATE_DESC(IM_STATE_SPEED_OBS_Q31, 1,
+						       tIMspeedObsQ31,
+						       asIMstateSpeedObsQ31);
+const tIMstateDesc sIMstateSpeedObsQ15 = IM_STATE_DESC(IM_STATE_SPEED_OBS_Q15, 1,
+						       tIMspeedObsQ15,
+						       asIMstateSpeedObsQ15);
+const tIMstateDesc sIMstateEkf = IM_STATE_DESC(IM_STATE_EKF, 1, tIMekf, asIMstateEkf);
+const tIMstateDesc sIMstateFluxObs = IM_STATE_DESC(IM_STATE_FLUX_OBS, 1, tIMfluxObs,
+						   asIMstateFluxObs);
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+const tIMstateDesc sIMstateFoc = IM_STATE_DESC(IM_STATE_FOC, 1, tIMfoc, asIMstateFoc);
+#endif
+const tIMstateDesc sIMstatePlantBank = IM_STATE_DESC(IM_STATE_PLANT_BANK, 1,
+						     tIMplantBank, asIMstatePlantBank);
+const tIMstateDesc sIMstateParamsEst = IM_STATE_DESC(IM_STATE_PARAMS_EST, 1,
+						     tIMparamsEst, asIMstateParamsEst);
+const tIMstateDesc sIMstateStartup = IM_STATE_DESC(IM_STATE_STARTUP, 1, tIMstartup,
+						   asIMstateStartup);
+
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  FNV-1a hash of the 32-bit words (the tail bytes are hashed one by one).
+  * @param  uHash: initial value of the hash,
+  *	    pvData: pointer to the data (any alignment),
+  *	    szSize: size of the data, bytes.
+  * @retval Hash value.
+  */
+static uint32_t imState_fnv(uint32_t uHash, const void* pvData, size_t szSize)
+{
+	const uint8_t* pu8 = (const uint8_t*)pvData;
+	uint32_t uWord;
+	
+	for(; szSize >= 4; szSize -= 4, pu8 += 4)
+	{
+		memcpy(&uWord, pu8, 4);
+		uHash = (uHash ^ uWord)*IM_STATE_FNV_PRIME;
+	}
+	for(; szSize > 0; szSize--) uHash = (uHash ^ *pu8++)*IM_STATE_FNV_PRIME;
+	return uHash;
+}
+
+/**
+  * @brief  Checksum of the payload: Fletcher sums (modulo 2^32) of IM_STATE_LANES
+  *	    interleaved 32-bit words lanes (independent additions, the cost is close
+  *	    to the copy of the payload), the sums and the tail bytes are hashed by
+  *	    FNV-1a.
+  * @param  pvData: pointer to the payload (any alignment),
+  *	    szSize: size of the payload, bytes.
+  * @retval Checksum value.
+  */
+static uint32_t imState_check(const void* pvData, size_t szSize)
+{
+	const uint8_t* pu8 = (const uint8_t*)pvData;
+	uint32_t auA[IM_STATE_LANES], auB[IM_STATE_LANES], auWord[IM_STATE_LANES];
+	uint32_t uHash = IM_STATE_FNV_BASIS;
+	unsigned l;
+	
+	for(l = 0; l < IM_STATE_LANES; l++) auA[l] = auB[l] = 0;
+	for(; szSize >= sizeof(auWord); szSize -= sizeof(auWord), pu8 += sizeof(auWord))
+	{
+		memcpy(auWord, pu8, sizeof(auWord));
+		for(l = 0; l < IM_STATE_LANES; l++)
+		{
+			auA[l] += auWord[l];
+			auB[l] += auA[l];
+		}
+	}
+	for(l = 0; l < IM_STATE_LANES; l++)	// sums are not addressed (registers)
+	{
+		uHash = (uHash ^ auA[l])*IM_STATE_FNV_PRIME;
+		uHash = (uHash ^ auB[l])*IM_STATE_FNV_PRIME;
+	}
+	return imState_fnv(uHash, pu8, szSize);
+}
+
+/**
+  * @brief  Layout signature of the type (type, version, size of the object and
+  *	    offsets and sizes of the fields).
+  * @param  ptDesc: pointer to the state descriptor.
+  * @retval Signature value.
+  */
+static uint32_t imState_layout(const tIMstateDesc* ptDesc)
+{
+	uint32_t uHash = IM_STATE_FNV_BASIS;
+	uint32_t auWord[4];
+	unsigned f;
+	
+	auWord[0] = ptDesc->uType;
+	auWord[1] = ptDesc->uVersion;
+	auWord[2] = ptDesc->uObjSize;
+	auWord[3] = ptDesc->uFields;
+	uHash = imState_fnv(uHash, auWord, sizeof(auWord));
+	for(f = 0; f < ptDesc->uFields; f++)
+	{
+		auWord[0] = ptDesc->ptField[f].uOfs;
+		auWord[1] = ptDesc->ptField[f].uSize;
+		uHash = imState_fnv(uHash, auWord, 2*sizeof(uint32_t));
+	}
+	return uHash;
+}
+
+/**
+  * @brief  Size of the state fields of one object.
+  * @param  ptDesc: pointer to the state descriptor.
+  * @retval Size, bytes.
+  */
+static size_t imState_objSize(const tIMstateDesc* ptDesc)
+{
+	size_t szSize = 0;
+	unsigned f;
+	
+	for(f = 0; f < ptDesc->uFields; f++) szSize += ptDesc->ptField[f].uSize;
+	return szSize;
+}
+
+/**
+  * @brief  Size of the snapshot of the objects array.
+  * @param  ptDesc: pointer to the state descriptor of the objects type,
+  *	    uNum: count of the objects.
+  * @retval Size of the header and payload, bytes.
+  */
+size_t tIMstate_size(const tIMstateDesc* ptDesc, unsigned uNum)
+{
+	return sizeof(tIMstateHdr) + imState_objSize(ptDesc)*uNum;
+}
+
+/**
+  * @brief  Save the snapshot of the state variables of the objects array (e.g. the
+  *	    bank or one object with uNum = 1).
+  * @param  ptDesc: pointer to the state descriptor of the objects type,
+  *	    pvObj: pointer to the objects array,
+  *	    uNum: count of the objects,
+  *	    pvBuf: pointer to the snapshot buffer (any alignment),
+  *	    szBuf: size of the snapshot buffer, bytes.
+  * @retval Size of the snapshot, bytes (0 - the buffer is too small).
+  */
+size_t tIMstate_save(const tIMstateDesc* ptDesc, const void* pvObj, unsigned uNum,
+		     void* pvBuf, size_t szBuf)
+{
+	const uint8_t* pu8Obj = (const uint8_t*)pvObj;
+	uint8_t* pu8Dst = (uint8_t*)pvBuf + sizeof(tIMstateHdr);
+	size_t szPay = imState_objSize(ptDesc)*uNum;
+	tIMstateHdr sHdr;
+	unsigned n, f;
+	
+	if(szBuf < sizeof(tIMstateHdr) + szPay) return 0;
+	
+	for(n = 0; n < uNum; n++, pu8Obj += ptDesc->uObjSize)
+	{
+		for(f = 0; f < ptDesc->uFields; f++)
+		{
+			memcpy(pu8Dst, pu8Obj + ptDesc->ptField[f].uOfs, ptDesc->ptField[f].uSize);
+			pu8Dst += ptDesc->ptField[f].uSize;
+		}
+	}
+	
+	sHdr.uMagic = IM_STATE_MAGIC;
+	sHdr.uVersion = IM_STATE_VERSION;
+	sHdr.uType = ptDesc->uType;
+	sHdr.uLayout = imState_layout(ptDesc);
+	sHdr.uNum = uNum;
+	sHdr.uSize = (uint32_t)szPay;
+	sHdr.uCheck = imState_check((uint8_t*)pvBuf + sizeof(tIMstateHdr), szPay);
+	memcpy(pvBuf, &sHdr, sizeof(tIMstateHdr));
+	return sizeof(tIMstateHdr) + szPay;
+}
+
+/**
+  * @brief  Restore the state variables of the objects array from the snapshot. The
+  *	    objects must be initialized (m_init) with the same configuration as the
+  *	    saved ones, the configuration, inputs and pointers are not changed.
+  *	    The objects are not changed when the snapshot is not valid.
+  * @param  ptDesc: pointer to the state descriptor of the objects type,
+  *	    pvObj: pointer to the objects array,
+  *	    uNum: count of the objects,
+  *	    pvBuf: pointer to the snapshot (any alignment),
+  *	    szBuf: size of the snapshot, bytes.
+  * @retval 0 - success, -1 - not valid snapshot (magic, type, layout, count of
+  *	    objects, size or checksum mismatch).
+  */
+int tIMstate_load(const tIMstateDesc* ptDesc, void* pvObj, unsigned uNum,
+		  const void* pvBuf, size_t szBuf)
+{
+	const uint8_t* pu8Src = (const uint8_t*)pvBuf + sizeof(tIMstateHdr);
+	uint8_t* pu8Obj = (uint8_t*)pvObj;
+	size_t szPay = imState_objSize(ptDesc)*uNum;
+	tIMstateHdr sHdr;
+	unsigned n, f;
+	
+	if(szBuf < sizeof(tIMstateHdr)) return -1;
+	memcpy(&sHdr, pvBuf, sizeof(tIMstateHdr));
+	if((sHdr.uMagic != IM_STATE_MAGIC) || (sHdr.uVersion != IM_STATE_VERSION) ||
+	   (sHdr.uType != ptDesc->uType) || (sHdr.uLayout != imState_layout(ptDesc)) ||
+	   (sHdr.uNum != uNum) || (sHdr.uSize != szPay) ||
+	   (szBuf < sizeof(tIMstateHdr) + szPay) ||
+	   (sHdr.uCheck != imState_check(pu8Src, szPay))) return -1;
+	
+	for(n = 0; n < uNum; n++, pu8Obj += ptDesc->uObjSize)
+	{
+		for(f = 0; f < ptDesc->uFields; f++)
+		{
+			memcpy(pu8Obj + ptDesc->ptField[f].uOfs, pu8Src, ptDesc->ptField[f].uSize);
+			pu8Src += ptDesc->ptField[f].uSize;
+		}
+	}
+	return 0;
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,187 @@
+/**
+  ***********************************************************************************
+  * @file    im_state.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the state snapshots of the estimators,
+  *	     P/I/D controllers and IM model (hot restore after the watchdog reset,
+  *	     fork of the simulations):
+  *		+ state variables only (the coefficients derived by m_init, inputs,
+  *		  pointers and functions pointers are not stored);
+  *		+ layout-versioned header with the payload checksum;
+  *		+ contiguous state of the banks (restored by one copy).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_STATE_H__
+#define __IM_STATE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+#include "im_foc.h"		// Field-oriented control pipeline
+#endif
+#include "im_speed_obs_bank.h"	// Bank of speed observers
+#include "im_ekf.h"		// Extended Kalman filter observer
+#include "im_flux_obs.h"	// Full order flux observers
+#include "im_plant.h"		// Bank of IM models
+#include "im_params_est.h"	// Online parameters estimation
+#include "im_startup.h"		// Startup identification
+#include "im_estimators_fx.h"	// Fixed-point estimators
+#include <stdint.h>
+#include <stddef.h>
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Snapshot format: the header "tIMstateHdr" (stored as is, native byte order)
+  *	   is followed by the payload, the state fields of the objects (fields
+  *	   of the first object, then of the second one, ...). The snapshot
+  *	   is valid for the same build only (type, version, size of the object,
+  *	   offsets and sizes of the fields are checked by the layout signature).
+  *	   The "tIMfoc" descriptor is not available with IM_SPEED_OBS_NO_FLUX_POLAR
+  *	   (as the FOC pipeline itself). IM_STATE_VERSION is
+  *	   the version of the header, the version of the state fields of every
+  *	   type is in its descriptor (increment on any change of the fields).
+  */
+#define IM_STATE_MAGIC		0x54534D49u	// "IMST"
+#define IM_STATE_VERSION	1
+
+#define IM_STATE_P_I		1		// Types of the objects
+#define IM_STATE_P_D		2
+#define IM_STATE_PID		3
+#define IM_STATE_PID_BANK	4
+#define IM_STATE_PI_Q31		5
+#define IM_STATE_PID_Q31	6
+#define IM_STATE_PI_Q15		7
+#define IM_STATE_PID_Q15	8
+#define IM_STATE_STAT_OBS	9
+#define IM_STATE_ROT_OBS	10
+#define IM_STATE_SPEED_OBS	11
+#define IM_STATE_SPEED_OBS_BANK	12
+#define IM_STATE_SPEED_OBS_Q31	13
+#define IM_STATE_SPEED_OBS_Q15	14
+#define IM_STATE_EKF		15
+#define IM_STATE_FLUX_OBS	16
+#define IM_STATE_FOC		17
+#define IM_STATE_PLANT_BANK	18
+#define IM_STATE_PARAMS_EST	19
+#define IM_STATE_STARTUP	20
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "State field" data structure (contiguous range of the state variables)
+  */
+typedef struct sIMstateField
+{
+	uint32_t	uOfs;			// Offset in the object, bytes
+	uint32_t	uSize;			// Size of the range, bytes
+} tIMstateField;
+
+/**
+  * @brief "State descriptor" data structure (one per type, constant)
+  */
+typedef struct sIMstateDesc
+{
+	uint16_t	uType;			// Type of the objects (IM_STATE_...)
+	uint16_t	uVersion;		// Version of the state fields
+	uint32_t	uObjSize;		// Size of the object (array stride), bytes
+	unsigned	uFields;		// Count of the state fields
+	const tIMstateField* ptField;		// State fields
+} tIMstateDesc;
+
+/**
+  * @brief "Snapshot header" data structure (24 bytes, stored as is)
+  */
+typedef struct sIMstateHdr
+{
+	uint32_t	uMagic;			// IM_STATE_MAGIC
+	uint16_t	uVersion;		// IM_STATE_VERSION
+	uint16_t	uType;			// Type of the objects (IM_STATE_...)
+	uint32_t	uLayout;		// Layout signature (type, version, object
+						// size, offsets and sizes of the fields)
+	uint32_t	uNum;			// Count of the objects
+	uint32_t	uSize;			// Size of the payload, bytes
+	uint32_t	uCheck;			// Checksum of the payload (Fletcher
+						// sums of 4 words lanes)
+} tIMstateHdr;
+
+/* Exported variables -------------------------------------------------------------*/
+
+/**
+  * @brief State descriptors of the types. The composite types store the state of
+  *	   the nested objects (e.g. "tIMfoc" - the speed observer and the current
+  *	   controllers), the state of the banks is one contiguous range.
+  */
+extern const tIMstateDesc sIMstatePI;		// "tPI"
+extern const tIMstateDesc sIMstatePD;		// "tPD"
+extern const tIMstateDesc sIMstatePID;		// "tPID"
+extern const tIMstateDesc sIMstatePIDbank;	// "tPIDbank"
+extern const tIMstateDesc sIMstatePIq31;	// "tPIq31"
+extern const tIMstateDesc sIMstatePIDq31;	// "tPIDq31"
+extern const tIMstateDesc sIMstatePIq15;	// "tPIq15"
+extern const tIMstateDesc sIMstatePIDq15;	// "tPIDq15"
+extern const tIMstateDesc sIMstateStatObs;	// "tIMstatObs"
+extern const tIMstateDesc sIMstateRotObs;	// "tIMrotObs"
+extern const tIMstateDesc sIMstateSpeedObs;	// "tIMspeedObs"
+extern const tIMstateDesc sIMstateSpeedObsBank;	// "tIMspeedObsBank"
+extern const tIMstateDesc sIMstateSpeedObsQ31;	// "tIMspeedObsQ31"
+extern const tIMstateDesc sIMstateSpeedObsQ15;	// "tIMspeedObsQ15"
+extern const tIMstateDesc sIMstateEkf;		// "tIMekf"
+extern const tIMstateDesc sIMstateFluxObs;	// "tIMfluxObs"
+#ifndef IM_SPEED_OBS_NO_FLUX_POLAR
+extern const tIMstateDesc sIMstateFoc;		// "tIMfoc"
+#endif
+extern const tIMstateDesc sIMstatePlantBank;	// "tIMplantBank"
+extern const tIMstateDesc sIMstateParamsEst;	// "tIMparamsEst"
+extern const tIMstateDesc sIMstateStartup;	// "tIMstartup"
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* Size of the snapshot of the objects array (header and payload) ******************/
+size_t tIMstate_size(const tIMstateDesc*, unsigned);
+
+/* Save the snapshot of the objects array (returns the size, 0 - small buffer) *****/
+size_t tIMstate_save(const tIMstateDesc*, const void*, unsigned, void*, size_t);
+
+/* Restore the objects array from the snapshot (initialized objects) ***************/
+int tIMstate_load(const tIMstateDesc*, void*, unsigned, const void*, size_t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_STATE_H__ */
+
+/*********************************** END OF FILE ***********************************/
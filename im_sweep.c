@@ -0,0 +1,322 @@
+/**
+  ***********************************************************************************
+  * @file    im_sweep.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the parameter
+  *	     sweep (grid search) of the induction motor (IM) rotor speed observer:
+  *		+ grid point decoding;
+  *		+ speed error RMS cost calculation over the captured dataset;
+  *		+ single thread or multithreaded (IM_SWEEP_PTHREAD) evaluation.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_sweep.h"
+#ifdef IM_SWEEP_PTHREAD
+#include <pthread.h>
+#endif
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/**
+  * @brief Worker (thread) data structure
+  */
+typedef struct sIMsweepWorker
+{
+	tIMsweep*	ptSweep;		// Pointer to sweep data structure
+	unsigned*	puNext;			// Pointer to shared index of the next
+						// not evaluated point
+	unsigned	uPoints;		// Count of grid points
+	unsigned	uBest;			// Index of the point with min cost
+	float		fBestCost;		// Min cost found by the worker
+} tIMsweepWorker;
+
+/* Private define -----------------------------------------------------------------*/
+
+#define IM_SWEEP_BLOCK		256	// Count of samples processed by one block call
+
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Value of the axis with index i.
+  * @param  ptAxis: pointer to data structure with type "tIMsweepAxis",
+  *	    fNom: nominal value (used when the axis has no values),
+  *	    i: index of the value.
+  * @retval Value of the axis.
+  */
+static float tIMsweepAxis_val(const tIMsweepAxis* ptAxis, float fNom, unsigned i)
+{
+	if(ptAxis->uNum == 0) return fNom;
+	if(ptAxis->uNum == 1) return ptAxis->fMin;
+	return ptAxis->fMin + (ptAxis->fMax - ptAxis->fMin)*(float)i/
+	       (float)(ptAxis->uNum - 1);
+}
+
+/**
+  * @brief  Count of values of the axis (at least one).
+  */
+static unsigned tIMsweepAxis_len(const tIMsweepAxis* ptAxis)
+{
+	return (ptAxis->uNum == 0) ? 1 : ptAxis->uNum;
+}
+
+/**
+  * @brief  Count of grid points.
+  * @param  ptSweep: pointer to user data structure with type "tIMsweep".
+  * @retval Count of grid points.
+  */
+unsigned tIMsweep_points(const tIMsweep* ptSweep)
+{
+	return tIMsweepAxis_len(&ptSweep->sKp)*tIMsweepAxis_len(&ptSweep->sKi)*
+	       tIMsweepAxis_len(&ptSweep->sRs)*tIMsweepAxis_len(&ptSweep->sRr)*
+	       tIMsweepAxis_len(&ptSweep->sLm);
+}
+
+/**
+  * @brief  Initialized IM parameters and PI-adapter settings of the grid point.
+  * @param  ptSweep: pointer to user data structure with type "tIMsweep",
+  *	    uIdx: index of the grid point,
+  *	    ptIMparams: pointer to output data structure with type "tIMparams",
+  *	    ptPI: pointer to output data structure with type "tPI".
+  * @retval None
+  */
+void tIMsweep_point(const tIMsweep* ptSweep, unsigned uIdx, tIMparams* ptIMparams,
+		    tPI* ptPI)
+{
+	unsigned uLen;
+
+	*ptIMparams = ptSweep->sIMparams;
+	*ptPI = ptSweep->sPI;
+
+	uLen = tIMsweepAxis_len(&ptSweep->sKp);
+	ptPI->fKp = tIMsweepAxis_val(&ptSweep->sKp, ptSweep->sPI.fKp, uIdx % uLen);
+	uIdx /= uLen;
+	uLen = tIMsweepAxis_len(&ptSweep->sKi);
+	ptPI->fKi = tIMsweepAxis_val(&ptSweep->sKi, ptSweep->sPI.fKi, uIdx % uLen);
+	uIdx /= uLen;
+	uLen = tIMsweepAxis_len(&ptSweep->sRs);
+	ptIMparams->fRs = tIMsweepAxis_val(&ptSweep->sRs, ptSweep->sIMparams.fRs,
+					   uIdx % uLen);
+	uIdx /= uLen;
+	uLen = tIMsweepAxis_len(&ptSweep->sRr);
+	ptIMparams->fRr = tIMsweepAxis_val(&ptSweep->sRr, ptSweep->sIMparams.fRr,
+					   uIdx % uLen);
+	uIdx /= uLen;
+	uLen = tIMsweepAxis_len(&ptSweep->sLm);
+	ptIMparams->fLm = tIMsweepAxis_val(&ptSweep->sLm, ptSweep->sIMparams.fLm,
+					   uIdx % uLen);
+
+	tIMparams_init(ptIMparams);
+	ptPI->fDtSec = ptIMparams->fDt;
+	tPI_init(ptPI);
+	tPI_rst(ptPI);
+}
+
+/**
+  * @brief  Check of the dataset: the speed reference is present and it has the
+  *	    samples after uSkip.
+  * @param  ptData: pointer to data structure with type "tIMdataset".
+  * @retval 0 - valid, -1 - no dataset, no reference or no scored samples.
+  */
+static int tIMsweep_check(const tIMdataset* ptData)
+{
+	if((ptData == 0) || (ptData->pfWrRef == 0) || (ptData->uSkip >= ptData->uNum))
+		return -1;
+	return 0;
+}
+
+/**
+  * @brief  Cost (speed error RMS versus reference) of the grid point. The function
+  *	    is reentrant: it uses the local observer and reads the dataset only.
+  * @param  ptSweep: pointer to user data structure with type "tIMsweep",
+  *	    uIdx: index of the grid point.
+  * @retval Speed error RMS, Rad/Sec (mechanical), HUGE_VALF - the dataset is not
+  *	    valid (no speed reference or no samples after uSkip).
+  */
+float tIMsweep_eval(const tIMsweep* ptSweep, unsigned uIdx)
+{
+	const tIMdataset* ptData = ptSweep->ptData;
+	tIMparams sIMparams;
+	tIMspeedObs sIMspeedObs = IM_SPEED_OBS_DEFAULTS;
+	float afWrE[IM_SWEEP_BLOCK];
+	tIMblockIn sIn;
+	tIMblockOut sOut = {afWrE, 0, 0, 1};
+	const float* pfWrRef;
+	double dSum = 0.0;
+	float f1divNpP;
+	size_t n;
+	unsigned k, uLen;
+
+	if(tIMsweep_check(ptData) != 0) return HUGE_VALF;	// never the best point
+	sIn = ptData->sIn;
+	pfWrRef = ptData->pfWrRef;
+
+	tIMsweep_point(ptSweep, uIdx, &sIMparams, &sIMspeedObs.sPI);
+	sIMspeedObs.m_init(&sIMspeedObs, &sIMparams);
+	f1divNpP = 1.0f/sIMparams.fNpP;
+
+	for(n = 0; n < ptData->uNum; n += uLen)
+	{
+		uLen = (ptData->uNum - n > IM_SWEEP_BLOCK) ? IM_SWEEP_BLOCK :
+		       (unsigned)(ptData->uNum - n);
+
+		tIMspeedObs_calcBlock(&sIMspeedObs, &sIMparams, &sIn, &sOut, uLen);
+
+		for(k = 0; k < uLen; k++, pfWrRef += ptData->uRefStride)
+		{
+			if(n + k >= ptData->uSkip)
+			{
+				float fErr = afWrE[k]*f1divNpP - *pfWrRef;
+
+				dSum += (double)fErr*fErr;
+			}
+		}
+
+		sIn.pfUsAl += uLen*sIn.uStride;
+		sIn.pfUsBe += uLen*sIn.uStride;
+		sIn.pfIsAl += uLen*sIn.uStride;
+		sIn.pfIsBe += uLen*sIn.uStride;
+	}
+
+	return (float)sqrt(dSum/(double)(ptData->uNum - ptData->uSkip));
+}
+
+/**
+  * @brief  Worker function: evaluate the chunks of IM_SWEEP_CHUNK points until all
+  *	    points are evaluated (dynamic scheduling by the shared atomic counter
+  *	    of the next point, so the faster threads take more chunks; no per
+  *	    thread queues and work-stealing).
+  * @param  pvWorker: pointer to data structure with type "tIMsweepWorker".
+  * @retval None
+  */
+static void* tIMsweep_worker(void* pvWorker)
+{
+	tIMsweepWorker* ptWorker = (tIMsweepWorker*)pvWorker;
+	tIMsweep* ptSweep = ptWorker->ptSweep;
+	unsigned i, uFirst, uLast;
+
+	for(;;)
+	{
+#ifdef IM_SWEEP_PTHREAD
+		uFirst = __atomic_fetch_add(ptWorker->puNext, IM_SWEEP_CHUNK,
+					    __ATOMIC_RELAXED);
+#else
+		uFirst = *ptWorker->puNext;
+		*ptWorker->puNext += IM_SWEEP_CHUNK;
+#endif
+		if(uFirst >= ptWorker->uPoints) break;
+
+		uLast = uFirst + IM_SWEEP_CHUNK;
+		if(uLast > ptWorker->uPoints) uLast = ptWorker->uPoints;
+
+		for(i = uFirst; i < uLast; i++)
+		{
+			float fCost = tIMsweep_eval(ptSweep, i);
+
+			if(ptSweep->pfCost) ptSweep->pfCost[i] = fCost;
+			// NaN (diverged observer) is never the best point
+			if((fCost < ptWorker->fBestCost) || ((fCost == ptWorker->fBestCost)
+			   && (i < ptWorker->uBest)))
+			{
+				ptWorker->fBestCost = fCost;
+				ptWorker->uBest = i;
+			}
+		}
+	}
+	return 0;
+}
+
+/**
+  * @brief  Cost evaluation of all grid points of the sweep. The point with the min
+  *	    cost (the first one of equal points) is stored in the outputs.
+  * @param  ptSweep: pointer to user data structure with type "tIMsweep".
+  * @retval 0 - success, -1 - the dataset is not valid (no speed reference, e.g.
+  *	    of the capture with 4 channels, or uSkip >= uNum), no point is evaluated.
+  */
+int tIMsweep_run(tIMsweep* ptSweep)
+{
+	unsigned uPoints = tIMsweep_points(ptSweep);
+	unsigned uNext = 0;
+	unsigned uThreads = 1, i;
+#ifdef IM_SWEEP_PTHREAD
+	tIMsweepWorker asWorker[IM_SWEEP_MAX_THREADS];
+	pthread_t atThread[IM_SWEEP_MAX_THREADS];
+
+	uThreads = ptSweep->uThreads;
+	if(uThreads > IM_SWEEP_MAX_THREADS) uThreads = IM_SWEEP_MAX_THREADS;
+	if(uThreads == 0) uThreads = 1;
+#else
+	tIMsweepWorker asWorker[1];
+#endif
+
+	ptSweep->uBest = 0;
+	ptSweep->fBestCost = HUGE_VALF;
+	if(tIMsweep_check(ptSweep->ptData) != 0) return -1;
+
+	for(i = 0; i < uThreads; i++)
+	{
+		asWorker[i].ptSweep = ptSweep;
+		asWorker[i].puNext = &uNext;
+		asWorker[i].uPoints = uPoints;
+		asWorker[i].uBest = uPoints;
+		asWorker[i].fBestCost = HUGE_VALF;
+	}
+
+#ifdef IM_SWEEP_PTHREAD
+	// the calling thread is the worker 0, threads which failed to start are skipped
+	for(i = 1; i < uThreads; i++)
+		if(pthread_create(&atThread[i], 0, tIMsweep_worker, &asWorker[i]) != 0) break;
+	uThreads = i;
+
+	tIMsweep_worker(&asWorker[0]);
+
+	for(i = 1; i < uThreads; i++) pthread_join(atThread[i], 0);
+#else
+	tIMsweep_worker(&asWorker[0]);
+#endif
+
+	ptSweep->uBest = asWorker[0].uBest;
+	ptSweep->fBestCost = asWorker[0].fBestCost;
+	for(i = 1; i < uThreads; i++)
+	{
+		if((asWorker[i].fBestCost < ptSweep->fBestCost) || ((asWorker[i].fBestCost ==
+		   ptSweep->fBestCost) && (asWorker[i].uBest < ptSweep->uBest)))
+		{
+			ptSweep->uBest = asWorker[i].uBest;
+			ptSweep->fBestCost = asWorker[i].fBestCost;
+		}
+	}
+	if(ptSweep->uBest >= uPoints) ptSweep->uBest = 0;	// all points diverged
+	return 0;
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,165 @@
+/**
+  ***********************************************************************************
+  * @file    im_sweep.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures and function
+  *	     prototypes for implementation the parameter sweep (grid search) of the
+  *	     induction motor (IM) rotor speed observer over the captured dataset:
+  *		+ PI-adapter coefficients (fKp, fKi) and motor parameters (fRs,
+  *		  fRr, fLm) grid;
+  *		+ speed error RMS cost versus encoder reference for every point;
+  *		+ multithreaded evaluation (POSIX threads, IM_SWEEP_PTHREAD).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_SWEEP_H__
+#define __IM_SWEEP_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_estimators.h" // Induction Motor estimators library
+#include <stddef.h>
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Define the IM_SWEEP_PTHREAD at compile time to evaluate the grid points by
+  *	   "uThreads" POSIX threads (link with -pthread). IM_SWEEP_MAX_THREADS is
+  *	   the max count of threads, IM_SWEEP_CHUNK is the count of grid points
+  *	   taken by a thread at once from the shared atomic counter of the next
+  *	   point (dynamic scheduling).
+  */
+#ifndef IM_SWEEP_MAX_THREADS
+#define IM_SWEEP_MAX_THREADS	64
+#endif
+
+#ifndef IM_SWEEP_CHUNK
+#define IM_SWEEP_CHUNK		8
+#endif
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "Captured dataset" data structure (the buffers are shared read-only by all
+  *	   threads, no copy is made)
+  */
+typedef struct sIMdataset
+{
+	tIMblockIn	sIn;			// Stator voltages and currents views
+	const float*	pfWrRef;		// Reference (encoder) rotor mechanical
+						// speed, Rad/Sec (required)
+	unsigned	uRefStride;		// Distance between reference samples
+	size_t		uNum;			// Count of samples
+	size_t		uSkip;			// Count of first samples excluded from
+						// the cost (observer convergence time,
+						// less than uNum)
+} tIMdataset;
+
+/**
+  * @brief "Sweep axis" data structure: uNum values from fMin to fMax with the
+  *	   linear step (uNum = 0 - nominal value is used)
+  */
+typedef struct sIMsweepAxis
+{
+	float		fMin;			// First value of axis
+	float		fMax;			// Last value of axis
+	unsigned	uNum;			// Count of values
+} tIMsweepAxis;
+
+/**
+  * @brief "IM speed observer parameter sweep Module" data structure
+  */
+typedef struct sIMsweep
+{
+// Inputs:
+	const tIMdataset* ptData;		// Pointer to captured dataset
+	tIMparams	sIMparams;		// Nominal IM parameters (not initialized
+						// by m_init is allowed)
+	tPI		sPI;			// Nominal PI-adapter settings (fKp, fKi,
+						// output limits)
+	tIMsweepAxis	sKp;			// PI-adapter proportional coef. axis
+	tIMsweepAxis	sKi;			// PI-adapter integral coef. axis
+	tIMsweepAxis	sRs;			// Stator resistance axis, Ohm
+	tIMsweepAxis	sRr;			// Rotor resistance axis, Ohm
+	tIMsweepAxis	sLm;			// Magnetizing inductance axis, H
+	float*		pfCost;			// Pointer to cost buffer (one value per
+						// point, NULL - not stored)
+	unsigned	uThreads;		// Count of threads (IM_SWEEP_PTHREAD)
+// Outputs:
+	unsigned	uBest;			// Index of the point with min cost
+	float		fBestCost;		// Min cost (speed error RMS), Rad/Sec
+						// (HUGE_VALF - not valid dataset)
+// Functions:
+	int	(*m_run)(struct sIMsweep*);	// Pointer to sweep function
+} tIMsweep;
+
+/**
+  * @brief Initialization constant with defaults for "tIMsweep" user variables
+  */
+#define IM_SWEEP_DEFAULTS {			\
+	.ptData		= 0,			\
+	.sIMparams	= IM_PARAMS_DEFAULTS,	\
+	.sPI		= PI_DEFAULTS,		\
+	.sKp		= {0.0f, 0.0f, 0},	\
+	.sKi		= {0.0f, 0.0f, 0},	\
+	.sRs		= {0.0f, 0.0f, 0},	\
+	.sRr		= {0.0f, 0.0f, 0},	\
+	.sLm		= {0.0f, 0.0f, 0},	\
+	.pfCost		= 0,			\
+	.uThreads	= 1,			\
+	.uBest		= 0,			\
+	.fBestCost	= 0.0f,			\
+	.m_run		= tIMsweep_run		\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* Count of grid points (fKp is the fastest changing axis, fLm is the slowest) ****/
+unsigned tIMsweep_points(const tIMsweep*);
+
+/* IM parameters and PI-adapter settings of the grid point *************************/
+void tIMsweep_point(const tIMsweep*, unsigned, tIMparams*, tPI*);
+
+/* Cost (speed error RMS) of the grid point (reentrant) ****************************/
+float tIMsweep_eval(const tIMsweep*, unsigned);
+
+/* Cost evaluation of all grid points **********************************************/
+int tIMsweep_run(tIMsweep*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_SWEEP_H__ */
+
+/*********************************** END OF FILE ***********************************/
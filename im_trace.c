@@ -0,0 +1,87 @@
+/**
+  ***********************************************************************************
+  * @file    im_trace.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides firmware functions for implementation the consumer
+  *	     side of the estimators run-time instrumentation:
+  *		+ ring buffer of snapshots draining;
+  *		+ execution time statistics reset.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_trace.h"
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+/* Private variables --------------------------------------------------------------*/
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Read the available snapshots from the ring buffer (consumer side, may
+  *	    run concurrently with the producer).
+  * @param  ptTrace: pointer to user data structure with type "tIMtrace",
+  *	    ptSnap: pointer to the output snapshots array,
+  *	    uMax: size of the output snapshots array.
+  * @retval Count of read snapshots.
+  */
+unsigned tIMtrace_drain(tIMtrace* ptTrace, tIMtraceSnap* ptSnap, unsigned uMax)
+{
+	uint32_t uTail = ptTrace->uTail;
+	uint32_t uHead = IM_TRACE_LOAD_ACQ(ptTrace->uHead);
+	unsigned n = 0;
+
+	while((uTail != uHead) && (n < uMax))
+	{
+		ptSnap[n++] = ptTrace->asRing[uTail & (IM_TRACE_RING_SIZE - 1)];
+		uTail++;
+	}
+	IM_TRACE_STORE_REL(ptTrace->uTail, uTail);
+	return n;
+}
+
+/**
+  * @brief  Reset the execution time statistics and the lost snapshots counter.
+  * @param  ptTrace: pointer to user data structure with type "tIMtrace".
+  * @retval None
+  */
+void tIMtrace_rst(tIMtrace* ptTrace)
+{
+	unsigned i;
+
+	ptTrace->uCount = 0;
+	ptTrace->uMin = 0xFFFFFFFFu;
+	ptTrace->uMax = 0;
+	ptTrace->uDropped = 0;
+	for(i = 0; i < IM_TRACE_HIST_BINS; i++) ptTrace->auHist[i] = 0;
+}
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,198 @@
+/**
+  ***********************************************************************************
+  * @file    im_trace.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the type definition of data structures, inline
+  *	     functions and function prototypes for implementation the run-time
+  *	     instrumentation of the estimators (enabled by IM_SPEED_OBS_TRACE):
+  *		+ execution time min/max/histogram accumulation;
+  *		+ lock-free single-producer single-consumer ring buffer of the
+  *		  internal signals snapshots.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_TRACE_H__
+#define __IM_TRACE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_cycles.h" // Execution time counter
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Size of the trace buffers, can be overridden by the user at compile time:
+  *	   IM_TRACE_HIST_BINS  - count of execution time histogram bins (the last
+  *				 bin accumulates all longer executions);
+  *	   IM_TRACE_HIST_SHIFT - width of histogram bin is 2^IM_TRACE_HIST_SHIFT
+  *				 ticks (IM_CYCLES_UNIT);
+  *	   IM_TRACE_RING_SIZE  - count of snapshots of the ring buffer (2^n).
+  */
+#ifndef IM_TRACE_HIST_BINS
+#define IM_TRACE_HIST_BINS	32
+#endif
+
+#ifndef IM_TRACE_HIST_SHIFT
+#define IM_TRACE_HIST_SHIFT	4
+#endif
+
+#ifndef IM_TRACE_RING_SIZE
+#define IM_TRACE_RING_SIZE	64
+#endif
+
+/* Exported types -----------------------------------------------------------------*/
+
+/**
+  * @brief "Snapshot of the speed observer internal signals" data structure
+  */
+typedef struct sIMtraceSnap
+{
+	uint32_t	uTime;			// Timestamp of the step, ticks
+	uint32_t	uExec;			// Execution time of the step, ticks
+	float		fPIin;			// PI-adapter input (speed error) sPI.fIn
+	float		fResAl;			// Back-EMF residual Alpha (EsAl - ErAl)
+	float		fResBe;			// Back-EMF residual Beta (EsBe - ErBe)
+	float		fWrE;			// Rotor electrical speed, Rad/Sec
+} tIMtraceSnap;
+
+/**
+  * @brief "Estimator trace Module" data structure. The execution time statistics
+  *	   and the ring buffer head are written by the estimator only (producer,
+  *	   e.g. ISR), the ring buffer tail is written by the drain function only
+  *	   (consumer, e.g. background task), so no lock is needed.
+  */
+typedef struct sIMtrace
+{
+// Inputs:
+	uint32_t	uSnapDiv;		// Snapshot of every uSnapDiv-th step
+						// (0 - snapshots are disabled)
+// Internal variables:
+	uint32_t	uSnapCnt;		// Steps counter of snapshots divider
+	volatile uint32_t uHead;		// Count of written snapshots (producer)
+	volatile uint32_t uTail;		// Count of read snapshots (consumer)
+	tIMtraceSnap	asRing[IM_TRACE_RING_SIZE];	// Snapshots ring buffer
+// Outputs:
+	uint32_t	uCount;			// Count of measured steps
+	uint32_t	uMin;			// Min execution time, ticks
+	uint32_t	uMax;			// Max execution time, ticks
+	uint32_t	uDropped;		// Count of snapshots lost (buffer full)
+	uint32_t	auHist[IM_TRACE_HIST_BINS];	// Execution time histogram
+} tIMtrace;
+
+/**
+  * @brief Initialization constant with defaults for "tIMtrace" user variables
+  *	   (all not listed variables are initialized with zeros)
+  */
+#define IM_TRACE_DEFAULTS {			\
+	.uSnapDiv	= 1,			\
+	.uMin		= 0xFFFFFFFFu		\
+}
+
+/* Exported macro -----------------------------------------------------------------*/
+
+/**
+  * @brief Ordering of the ring buffer accesses (release store of the head/tail after
+  *	   the slot access, acquire load of the other side's index)
+  */
+#if defined(__GNUC__) || defined(__clang__)
+#define IM_TRACE_LOAD_ACQ(x)		__atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define IM_TRACE_STORE_REL(x, v)	__atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define IM_TRACE_LOAD_ACQ(x)		(x)
+#define IM_TRACE_STORE_REL(x, v)	((x) = (v))
+#endif
+
+/* Exported functions -------------------------------------------------------------*/
+
+/**
+  * @brief  Accumulate the execution time of the step (producer side).
+  * @param  ptTrace: pointer to user data structure with type "tIMtrace",
+  *	    uExec: execution time of the step, ticks.
+  * @retval None
+  */
+static inline void tIMtrace_time(tIMtrace* ptTrace, uint32_t uExec)
+{
+	uint32_t uBin = uExec >> IM_TRACE_HIST_SHIFT;
+
+	if(uBin >= IM_TRACE_HIST_BINS) uBin = IM_TRACE_HIST_BINS - 1;
+	ptTrace->auHist[uBin]++;
+	ptTrace->uCount++;
+	if(uExec < ptTrace->uMin) ptTrace->uMin = uExec;
+	if(uExec > ptTrace->uMax) ptTrace->uMax = uExec;
+}
+
+/**
+  * @brief  Write the snapshot to the ring buffer (producer side), the snapshot is
+  *	    dropped when the buffer is full.
+  * @param  ptTrace: pointer to user data structure with type "tIMtrace",
+  *	    ptSnap: pointer to the snapshot.
+  * @retval None
+  */
+static inline void tIMtrace_push(tIMtrace* ptTrace, const tIMtraceSnap* ptSnap)
+{
+	uint32_t uHead = ptTrace->uHead;
+
+	if(uHead - IM_TRACE_LOAD_ACQ(ptTrace->uTail) >= IM_TRACE_RING_SIZE)
+	{
+		ptTrace->uDropped++;
+		return;
+	}
+	ptTrace->asRing[uHead & (IM_TRACE_RING_SIZE - 1)] = *ptSnap;
+	IM_TRACE_STORE_REL(ptTrace->uHead, uHead + 1);
+}
+
+/**
+  * @brief  Check the snapshots divider (producer side).
+  * @param  ptTrace: pointer to user data structure with type "tIMtrace".
+  * @retval Non-zero when the snapshot of the current step must be written.
+  */
+static inline int tIMtrace_snapTime(tIMtrace* ptTrace)
+{
+	if(ptTrace->uSnapDiv == 0) return 0;
+	if(++ptTrace->uSnapCnt < ptTrace->uSnapDiv) return 0;
+	ptTrace->uSnapCnt = 0;
+	return 1;
+}
+
+/* Read the snapshots from the ring buffer (consumer side) *************************/
+unsigned tIMtrace_drain(tIMtrace*, tIMtraceSnap*, unsigned);
+
+/* Reset the execution time statistics (must not run concurrently with producer) ***/
+void tIMtrace_rst(tIMtrace*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_TRACE_H__ */
+
+/*********************************** END OF FILE ***********************************/
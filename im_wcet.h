@@ -0,0 +1,152 @@
+/**
+  ***********************************************************************************
+  * @file    im_wcet.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the description and the inline functions of the
+  *	     constant time build profile (enabled by IM_WCET_PROFILE):
+  *		+ flush-to-zero of the denormal numbers;
+  *		+ list of the constant time calculation functions (the report of
+  *		  the worst case execution time is in the README.md).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_WCET_H__
+#define __IM_WCET_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+#include <stdint.h>
+#if !defined(__ARM_FP) && (defined(__SSE__) || defined(_M_X64))
+#include <xmmintrin.h>
+#endif
+
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Constant time build profile: define the IM_WCET_PROFILE at compile time
+  *	   for all library files. The profile sets:
+  *	   - IM_FAST_MATH = 2 by default (polynomial angle and magnitude, the
+  *	     standard "atan2f"/"hypotf" are not allowed);
+  *	   - "imSinCosf" instead of "cosf"/"sinf"/"tanf" in "tIMrotObs_calcExact",
+  *	     "tIMrotObs_calcBilin" and the fallback of "tIMrotObs_calcLut";
+  *	   - selects instead of the branches of the data dependent paths (the
+  *	     exact rotor model, the voltage limitation of "tIMfoc_calc").
+  *	   The saturations of the P/I/D controllers and the estimators are the
+  *	   min/max selects in all builds (PID_SATF, no branches). The denormal
+  *	   numbers are flushed to zero by "imWcet_init" (FPU control register).
+  *	   The execution paths which stay data dependent in the profile are the
+  *	   configuration ones (uDecim, uAngTrack, the range of the rotor model
+  *	   table) and the bounded resynchronization of the flux angle tracking.
+  */
+/**
+  * @brief Static WCET report of the profile build (upper bounds of CPU cycles per
+  *	   call, Cortex-M7 FPv5-SP, code and data in TCM, zero wait states). The
+  *	   counts of the operations are taken from the "-O2 -fno-math-errno"
+  *	   build of the profile (scalar code, all paths of the function are
+  *	   summed, the operations of the called m_calc included), the cost
+  *	   model is: 3 cycles per FP add/mul/compare/select and other operation
+  *	   (result latency, no dual issue), 14 per division/square root, 2 per
+  *	   load/store, 10 per call/return ("calls": the function entry and the
+  *	   calls of the sub-observers and PI-controllers through m_calc).
+  *
+  *	   Function			add/mul	div/sqrt other	ld/st	calls	cycles
+  *	   tIMstatObs_calc		12	0	0	14	1	74
+  *	   tIMstatObs_calcFilt		16	0	0	15	1	88
+  *	   tIMrotObs_calc		16	0	0	21	1	100
+  *	   tIMrotObs_calcExact		72	2	12	41	1	372
+  *	   tIMrotObs_calcBilin		74	2	13	43	1	385
+  *	   tIMrotObs_calcRK2		32	0	1	22	1	153
+  *	   tIMrotObs_calcLut		121	3	19	75	1	622
+  *	   tPI_calc			12	0	5	16	1	93
+  *	   tPID_calc			16	0	5	22	1	117
+  *	   tIMspeedObs_calc (1)		120	4	23	179	4	883
+  *	   tIMfluxObs_calcLuen/Smo (2)	87	1	21	68	2	494
+  *	   tIMekf_calc			392	4	9	235	1	1739
+  *	   tIMfoc_calc (3)		-	-	-	-	-	1370
+  *
+  *	   (1) full rate (uDecim = 1) with the default m_calc of the stator and
+  *	       rotor observers, the other rotor observers add the difference of
+  *	       their bounds to "tIMrotObs_calc";
+  *	   (2) including the speed adaptation PI-controller;
+  *	   (3) including "tIMspeedObs_calc" (1) and two current PI-controllers.
+  *	   The bounds are the estimation of the code (not measured), verify them
+  *	   on the target by the benchmark and IM_SPEED_OBS_TRACE "uMax".
+  */
+#define IM_WCET_CYC_STAT_OBS		74
+#define IM_WCET_CYC_STAT_OBS_FILT	88
+#define IM_WCET_CYC_ROT_OBS		100
+#define IM_WCET_CYC_ROT_OBS_EXACT	372
+#define IM_WCET_CYC_ROT_OBS_BILIN	385
+#define IM_WCET_CYC_ROT_OBS_RK2		153
+#define IM_WCET_CYC_ROT_OBS_LUT		622
+#define IM_WCET_CYC_PI			93
+#define IM_WCET_CYC_PID			117
+#define IM_WCET_CYC_SPEED_OBS		883
+#define IM_WCET_CYC_FLUX_OBS		494
+#define IM_WCET_CYC_EKF			1739
+#define IM_WCET_CYC_FOC			1370
+
+#define IM_FPSCR_FZ		(1u << 24)				// Flush-to-zero bit
+#define IM_FPDSCR		(*(volatile uint32_t*)0xE000EF3Cu)	// FP Default Status
+									// Control (Cortex-M)
+
+/* Exported functions -------------------------------------------------------------*/
+
+/**
+  * @brief  Enable the flush-to-zero of the denormal numbers: FPSCR.FZ of Cortex-M
+  *	    (current context) and FPDSCR.FZ (default of the exception handlers
+  *	    contexts, so the ISRs inherit it), MXCSR.FTZ/DAZ of the x86 host. Call
+  *	    once at the startup (and in every host thread).
+  * @param  None
+  * @retval None
+  */
+static inline void imWcet_init(void)
+{
+#if defined(__ARM_FP) && (defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || \
+			  defined(__ARM_ARCH_8_1M_MAIN__))
+	uint32_t uFpscr;
+	
+	__asm volatile ("vmrs %0, fpscr" : "=r" (uFpscr));
+	__asm volatile ("vmsr fpscr, %0" : : "r" (uFpscr | IM_FPSCR_FZ) : "memory");
+	IM_FPDSCR |= IM_FPSCR_FZ;
+#elif defined(__SSE__) || defined(_M_X64)
+	_mm_setcsr(_mm_getcsr() | 0x8040u);	// FTZ (bit 15) and DAZ (bit 6)
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_WCET_H__ */
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,507 @@
+/**
+  ***********************************************************************************
+  * @file    im_test.c
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides the host regression test of the speed observer
+  *	     variants on the signals of the batched plant model:
+  *		+ tIMspeedObs_calc (reference) against the plant rotor speed;
+  *		+ bank (calc, calcTab, calcRef), block and bound variants and the
+  *		  C++ observer (bit-equal with -ffp-contract=off);
+  *		+ Q31 observer (tolerance of the per-unit scaling);
+  *		+ offline batch evaluation of the capture files (error statistics).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_test.h"
+#include "im_plant.h"
+#include "im_speed_obs_bank.h"
+#include "im_estimators_fx.h"
+#include "im_batch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Private typedef ----------------------------------------------------------------*/
+/* Private define -----------------------------------------------------------------*/
+
+#define IM_TEST_BLOCK		1000	// Count of samples of the block function call
+
+#define IM_TEST_IBASE		10.0f	// Q31 base values of currents, voltages, speed
+#define IM_TEST_UBASE		400.0f	// and flux
+#define IM_TEST_WBASE		1000.0f
+#define IM_TEST_FBASE		2.0f
+
+#define IM_TEST_TOL_WR		10.0f	// Max abs error of the reference observer
+					// against the plant (mechanical), Rad/Sec
+#define IM_TEST_TOL_Q31_WR	0.05f	// Max abs error of the Q31 observer, Rad/Sec
+#define IM_TEST_TOL_Q31_FR	0.0005f	// and Wb
+#define IM_TEST_TOL_RMS		1e-4f	// Relative error of the batch RMS (float sums)
+
+/* Private constants --------------------------------------------------------------*/
+/* Private macro ------------------------------------------------------------------*/
+
+/* index of the sample k of the motor m */
+#define IM_TEST_IDX(m, k)	((size_t)(m)*IM_TEST_STEPS + (k))
+
+/* Private variables --------------------------------------------------------------*/
+
+static tIMparams sIMparams = IM_PARAMS_DEFAULTS;
+static tPI sPI = PI_DEFAULTS;
+static float* pfRec;			// Records of all motors (IM_TEST_REC per sample)
+static float* pfRef;			// Reference outputs (IM_TEST_OUT per sample)
+
+/* Private function prototypes ----------------------------------------------------*/
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Motor parameters and PI-adapter settings of the test.
+  * @param  None
+  * @retval None
+  */
+static void tIMtest_setup(void)
+{
+	sIMparams.fDt = IM_TEST_DT;
+	sIMparams.fNpP = IM_TEST_NPP;
+	sIMparams.fRs = IM_TEST_RS;
+	sIMparams.fRr = IM_TEST_RR;
+	sIMparams.fLs = IM_TEST_LS;
+	sIMparams.fLr = IM_TEST_LR;
+	sIMparams.fLm = IM_TEST_LM;
+	sIMparams.m_init(&sIMparams);
+	
+	sPI.fDtSec = IM_TEST_DT;
+	sPI.fKp = IM_TEST_KP;
+	sPI.fKi = IM_TEST_KI;
+	sPI.fUpOutLim = IM_TEST_LIM;
+	sPI.fLowOutLim = -IM_TEST_LIM;
+	sPI.m_init(&sPI);
+}
+
+/**
+  * @brief  Records of the plant signals: V/f start of the motor m to the
+  *	    (100 + 20*m) Rad/Sec supply frequency, then the load step.
+  * @param  None
+  * @retval 0 - success, -1 - not valid profiles.
+  */
+static int tIMtest_plant(void)
+{
+	static tIMplantBank sPlant = IM_PLANT_BANK_DEFAULTS;
+	static tIMprofile asProfile[IM_TEST_MOTORS];
+	unsigned m, k;
+	
+	sPlant.m_rst(&sPlant);
+	for(m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		float fWs = 100.0f + 20.0f*(float)m;
+		
+		asProfile[m] = (tIMprofile){.uNum = 4, .afT = {0.0f, 1.0f, 2.0f, 2.5f},
+					    .afWs = {0.0f, fWs, fWs, fWs},
+					    .afTl = {0.0f, 0.0f, 0.0f, 2.0f}};
+		sPlant.aptProfile[m] = &asProfile[m];
+	}
+	if(sPlant.m_init(&sPlant, &sIMparams) != 0) return -1;
+	
+	for(k = 0; k < IM_TEST_STEPS; k++)
+	{
+		sPlant.m_calc(&sPlant, &sIMparams, IM_TEST_MOTORS);
+		for(m = 0; m < IM_TEST_MOTORS; m++)
+		{
+			float* pfIn = &pfRec[IM_TEST_IDX(m, k)*IM_TEST_REC];
+			
+			pfIn[IM_CAP_CH_USAL] = sPlant.afUsAl[m];
+			pfIn[IM_CAP_CH_USBE] = sPlant.afUsBe[m];
+			pfIn[IM_CAP_CH_ISAL] = sPlant.afIsAl[m];
+			pfIn[IM_CAP_CH_ISBE] = sPlant.afIsBe[m];
+			pfIn[IM_CAP_CH_WRREF] = sPlant.afWrE[m]/IM_TEST_NPP;
+		}
+	}
+	return 0;
+}
+
+/**
+  * @brief  Reference outputs of "tIMspeedObs_calc" for all motors.
+  * @param  None
+  * @retval None
+  */
+static void tIMtest_ref(void)
+{
+	unsigned m, k;
+	
+	for(m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		tIMspeedObs sObs = IM_SPEED_OBS_DEFAULTS;
+		
+		sObs.sPI = sPI;
+		sObs.m_init(&sObs, &sIMparams);
+		for(k = 0; k < IM_TEST_STEPS; k++)
+		{
+			const float* pfIn = &pfRec[IM_TEST_IDX(m, k)*IM_TEST_REC];
+			float* pfOut = &pfRef[IM_TEST_IDX(m, k)*IM_TEST_OUT];
+			
+			sObs.fUsAl = pfIn[IM_CAP_CH_USAL];
+			sObs.fUsBe = pfIn[IM_CAP_CH_USBE];
+			sObs.fIsAl = pfIn[IM_CAP_CH_ISAL];
+			sObs.fIsBe = pfIn[IM_CAP_CH_ISBE];
+			sObs.m_calc(&sObs, &sIMparams);
+			pfOut[0] = sObs.fWrE;
+			pfOut[1] = sObs.fFrAng;
+			pfOut[2] = sObs.fFrMagn;
+		}
+	}
+}
+
+/**
+  * @brief  Bit-equal comparison of the outputs with the reference.
+  * @param  m: index of the motor,
+  *	    k: index of the sample,
+  *	    fWrE, fFrAng, fFrMagn: outputs of the tested observer.
+  * @retval 0 - equal, 1 - not equal.
+  */
+static int tIMtest_cmp(unsigned m, unsigned k, float fWrE, float fFrAng, float fFrMagn)
+{
+	const float afOut[IM_TEST_OUT] = {fWrE, fFrAng, fFrMagn};
+	
+	return memcmp(afOut, &pfRef[IM_TEST_IDX(m, k)*IM_TEST_OUT], sizeof(afOut)) ? 1 : 0;
+}
+
+/**
+  * @brief  Reference observer against the plant rotor speed after convergence.
+  * @param  None
+  * @retval Count of samples out of the tolerance.
+  */
+static int tIMtest_truth(void)
+{
+	unsigned m, k;
+	int iBad = 0;
+	
+	for(m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		for(k = IM_TEST_SKIP; k < IM_TEST_STEPS; k++)
+		{
+			float fWr = pfRef[IM_TEST_IDX(m, k)*IM_TEST_OUT]/IM_TEST_NPP;
+			
+			if(!(fabsf(fWr - pfRec[IM_TEST_IDX(m, k)*IM_TEST_REC + IM_CAP_CH_WRREF]) <=
+			     IM_TEST_TOL_WR)) iBad++;
+		}
+	}
+	return iBad;
+}
+
+/**
+  * @brief  Bank of observers (all motors in one bank, two equal parameters sets of
+  *	    calcTab) against the reference.
+  * @param  uFunc: 0 - tIMspeedObsBank_calc, 1 - tIMspeedObsBank_calcTab,
+  *	    2 - tIMspeedObsBank_calcRef.
+  * @retval Count of not equal samples.
+  */
+static int tIMtest_bank(unsigned uFunc)
+{
+	static tIMspeedObsBank sBank = IM_SPEED_OBS_BANK_DEFAULTS;
+	tIMparams asIMparamsTab[2];
+	unsigned m, k;
+	int iBad = 0;
+	
+	sBank.m_rst(&sBank);
+	for(m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		sBank.afKp[m] = sPI.fKp;
+		sBank.afKi[m] = sPI.fKi;
+		sBank.afUpOutLim[m] = sPI.fUpOutLim;
+		sBank.afLowOutLim[m] = sPI.fLowOutLim;
+		sBank.auAwMode[m] = sPI.uAwMode;
+		sBank.afKaw[m] = sPI.fKaw;
+		sBank.auParams[m] = (2*m)/IM_TEST_MOTORS;	// two sets (sorted)
+	}
+	asIMparamsTab[0] = asIMparamsTab[1] = sIMparams;
+	
+	for(k = 0; k < IM_TEST_STEPS; k++)
+	{
+		for(m = 0; m < IM_TEST_MOTORS; m++)
+		{
+			const float* pfIn = &pfRec[IM_TEST_IDX(m, k)*IM_TEST_REC];
+			
+			sBank.afUsAl[m] = pfIn[IM_CAP_CH_USAL];
+			sBank.afUsBe[m] = pfIn[IM_CAP_CH_USBE];
+			sBank.afIsAl[m] = pfIn[IM_CAP_CH_ISAL];
+			sBank.afIsBe[m] = pfIn[IM_CAP_CH_ISBE];
+		}
+		if(uFunc == 0) sBank.m_calc(&sBank, &sIMparams, IM_TEST_MOTORS);
+		else if(uFunc == 1) tIMspeedObsBank_calcTab(&sBank, asIMparamsTab, 2, IM_TEST_MOTORS);
+		else tIMspeedObsBank_calcRef(&sBank, &sIMparams, IM_TEST_MOTORS);
+		
+		for(m = 0; m < IM_TEST_MOTORS; m++)
+			iBad += tIMtest_cmp(m, k, sBank.afWrE[m], sBank.afFrAng[m], sBank.afFrMagn[m]);
+	}
+	return iBad;
+}
+
+/**
+  * @brief  Block function (replay of the records by IM_TEST_BLOCK samples) against
+  *	    the reference.
+  * @param  None
+  * @retval Count of not equal samples, -1 - memory allocation error.
+  */
+static int tIMtest_block(void)
+{
+	float* pfOut = malloc(sizeof(float)*IM_TEST_OUT*IM_TEST_BLOCK);
+	unsigned m, k, n;
+	int iBad = 0;
+	
+	if(!pfOut) return -1;
+	for(m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		tIMspeedObs sObs = IM_SPEED_OBS_DEFAULTS;
+		tIMblockOut sOut = {pfOut, pfOut + 1, pfOut + 2, IM_TEST_OUT};
+		
+		sObs.sPI = sPI;
+		sObs.m_init(&sObs, &sIMparams);
+		for(k = 0; k < IM_TEST_STEPS; k += IM_TEST_BLOCK)
+		{
+			const float* pfIn = &pfRec[IM_TEST_IDX(m, k)*IM_TEST_REC];
+			tIMblockIn sIn = {pfIn + IM_CAP_CH_USAL, pfIn + IM_CAP_CH_USBE,
+					  pfIn + IM_CAP_CH_ISAL, pfIn + IM_CAP_CH_ISBE, IM_TEST_REC};
+			
+			tIMspeedObs_calcBlock(&sObs, &sIMparams, &sIn, &sOut, IM_TEST_BLOCK);
+			for(n = 0; n < IM_TEST_BLOCK; n++)
+				iBad += tIMtest_cmp(m, k + n, pfOut[n*IM_TEST_OUT],
+						    pfOut[n*IM_TEST_OUT + 1], pfOut[n*IM_TEST_OUT + 2]);
+		}
+	}
+	free(pfOut);
+	return iBad;
+}
+
+/**
+  * @brief  Bound inputs (the observer reads the buffer of the last sample, as written
+  *	    by DMA) against the reference.
+  * @param  None
+  * @retval Count of not equal samples.
+  */
+static int tIMtest_bound(void)
+{
+	float afAdc[IM_CAP_CH_ISBE + 1];
+	unsigned m, k;
+	int iBad = 0;
+	
+	for(m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		tIMspeedObs sObs = IM_SPEED_OBS_DEFAULTS;
+		
+		sObs.sPI = sPI;
+		sObs.m_calc = tIMspeedObs_calcBound;
+		sObs.sBind.pfUsAl = &afAdc[IM_CAP_CH_USAL];
+		sObs.sBind.pfUsBe = &afAdc[IM_CAP_CH_USBE];
+		sObs.sBind.pfIsAl = &afAdc[IM_CAP_CH_ISAL];
+		sObs.sBind.pfIsBe = &afAdc[IM_CAP_CH_ISBE];
+		sObs.m_init(&sObs, &sIMparams);
+		for(k = 0; k < IM_TEST_STEPS; k++)
+		{
+			memcpy(afAdc, &pfRec[IM_TEST_IDX(m, k)*IM_TEST_REC], sizeof(afAdc));
+			sObs.m_calc(&sObs, &sIMparams);
+			iBad += tIMtest_cmp(m, k, sObs.fWrE, sObs.fFrAng, sObs.fFrMagn);
+		}
+	}
+	return iBad;
+}
+
+/**
+  * @brief  Q31 observer against the reference after convergence (per-unit inputs
+  *	    of IM_TEST_IBASE, IM_TEST_UBASE).
+  * @param  None
+  * @retval Count of samples out of the tolerance.
+  */
+static int tIMtest_q31(void)
+{
+	tIMparamsQ31 sIMparamsQ31 = IM_PARAMS_Q31_DEFAULTS;
+	unsigned m, k;
+	int iBad = 0;
+	
+	sIMparamsQ31.fDt = sIMparams.fDt;
+	sIMparamsQ31.fNpP = sIMparams.fNpP;
+	sIMparamsQ31.fRs = sIMparams.fRs;
+	sIMparamsQ31.fRr = sIMparams.fRr;
+	sIMparamsQ31.fLs = sIMparams.fLs;
+	sIMparamsQ31.fLr = sIMparams.fLr;
+	sIMparamsQ31.fLm = sIMparams.fLm;
+	sIMparamsQ31.fIbase = IM_TEST_IBASE;
+	sIMparamsQ31.fUbase = IM_TEST_UBASE;
+	sIMparamsQ31.fWbase = IM_TEST_WBASE;
+	sIMparamsQ31.fFbase = IM_TEST_FBASE;
+	sIMparamsQ31.m_init(&sIMparamsQ31);
+	
+	for(m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		tIMspeedObsQ31 sObs = IM_SPEED_OBS_Q31_DEFAULTS;
+		
+		sObs.sPI.fDtSec = sPI.fDtSec;
+		sObs.sPI.fKp = sPI.fKp;
+		sObs.sPI.fKi = sPI.fKi;
+		sObs.sPI.fUpOutLim = sPI.fUpOutLim;
+		sObs.sPI.fLowOutLim = sPI.fLowOutLim;
+		sObs.m_init(&sObs, &sIMparamsQ31);
+		for(k = 0; k < IM_TEST_STEPS; k++)
+		{
+			const float* pfIn = &pfRec[IM_TEST_IDX(m, k)*IM_TEST_REC];
+			const float* pfOut = &pfRef[IM_TEST_IDX(m, k)*IM_TEST_OUT];
+			
+			sObs.qUsAl = q31_from_float(pfIn[IM_CAP_CH_USAL]/IM_TEST_UBASE);
+			sObs.qUsBe = q31_from_float(pfIn[IM_CAP_CH_USBE]/IM_TEST_UBASE);
+			sObs.qIsAl = q31_from_float(pfIn[IM_CAP_CH_ISAL]/IM_TEST_IBASE);
+			sObs.qIsBe = q31_from_float(pfIn[IM_CAP_CH_ISBE]/IM_TEST_IBASE);
+			sObs.m_calc(&sObs, &sIMparamsQ31);
+			if(k < IM_TEST_SKIP) continue;
+			
+			if(!(fabsf(q31_to_float(sObs.qWrE)*IM_TEST_WBASE - pfOut[0]) <=
+			     IM_TEST_TOL_Q31_WR) ||
+			   !(fabsf(q31_to_float(sObs.qFrMagn)*IM_TEST_FBASE - pfOut[2]) <=
+			     IM_TEST_TOL_Q31_FR)) iBad++;
+		}
+	}
+	return iBad;
+}
+
+/**
+  * @brief  Batch evaluation of the float32 capture files of the records against the
+  *	    error statistics of the reference (max abs error is bit-equal, mean and
+  *	    RMS within the rounding of the float sums).
+  * @param  None
+  * @retval Count of not equal lanes, -1 - capture file or batch error.
+  */
+static int tIMtest_batch(void)
+{
+	static tIMcapture asCap[IM_TEST_MOTORS];
+	static tIMbatchRes asRes[IM_TEST_MOTORS];
+	tIMbatch sBatch = IM_BATCH_DEFAULTS;
+	char acPath[32];
+	unsigned m, k, uOpen = 0;
+	int iBad = -1;
+	
+	for(m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		const float* pfIn = &pfRec[IM_TEST_IDX(m, 0)*IM_TEST_REC];
+		tIMdataset sData = {{pfIn + IM_CAP_CH_USAL, pfIn + IM_CAP_CH_USBE,
+				     pfIn + IM_CAP_CH_ISAL, pfIn + IM_CAP_CH_ISBE, IM_TEST_REC},
+				    pfIn + IM_CAP_CH_WRREF, IM_TEST_REC, IM_TEST_STEPS, 0};
+		
+		sprintf(acPath, "im_test_%02u.imc", m);
+		if(tIMcapture_write(acPath, &sIMparams, IM_CAP_F32, 0, &sData) != 0) break;
+		if(tIMcapture_open(&asCap[m], acPath) != 0) break;
+		uOpen++;
+	}
+	
+	sBatch.ptCap = asCap;
+	sBatch.uLanes = IM_TEST_MOTORS;
+	sBatch.sPI = sPI;
+	sBatch.uSkip = IM_TEST_SKIP;
+	sBatch.ptRes = asRes;
+	if((uOpen == IM_TEST_MOTORS) && (sBatch.m_run(&sBatch) == 0))
+	{
+		iBad = 0;
+		for(m = 0; m < IM_TEST_MOTORS; m++)
+		{
+			double dErr = 0.0, dErr2 = 0.0, dRms;
+			float fErrMax = 0.0f;
+			
+			for(k = IM_TEST_SKIP; k < IM_TEST_STEPS; k++)
+			{
+				float fE = pfRef[IM_TEST_IDX(m, k)*IM_TEST_OUT]*(1.0f/IM_TEST_NPP) -
+					   pfRec[IM_TEST_IDX(m, k)*IM_TEST_REC + IM_CAP_CH_WRREF];
+				
+				dErr += (double)fE;
+				dErr2 += (double)fE*(double)fE;
+				if(fabsf(fE) > fErrMax) fErrMax = fabsf(fE);
+			}
+			dErr /= (double)(IM_TEST_STEPS - IM_TEST_SKIP);
+			dRms = sqrt(dErr2/(double)(IM_TEST_STEPS - IM_TEST_SKIP));
+			
+			if((asRes[m].uNum != IM_TEST_STEPS - IM_TEST_SKIP) || asRes[m].iDiverged ||
+			   memcmp(&asRes[m].fErrMax, &fErrMax, sizeof(float)) ||
+			   !(fabs(asRes[m].fErrMean - dErr) <= IM_TEST_TOL_RMS*dRms) ||
+			   !(fabs(asRes[m].fErrRms - dRms) <= IM_TEST_TOL_RMS*dRms)) iBad++;
+		}
+	}
+	
+	for(m = 0; m < uOpen; m++) tIMcapture_close(&asCap[m]);
+	for(m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		sprintf(acPath, "im_test_%02u.imc", m);
+		remove(acPath);
+	}
+	return iBad;
+}
+
+/**
+  * @brief  Print the result of the test case.
+  * @param  pcName: name of the tested function,
+  *	    iBad: count of failed samples or lanes (-1 - not run).
+  * @retval 0 - passed, 1 - failed.
+  */
+static unsigned tIMtest_report(const char* pcName, int iBad)
+{
+	if(iBad == 0) printf("%-28s ok\n", pcName);
+	else if(iBad < 0) printf("%-28s FAILED (not run)\n", pcName);
+	else printf("%-28s FAILED (%d)\n", pcName, iBad);
+	return (iBad == 0) ? 0u : 1u;
+}
+
+/**
+  * @brief  Host regression test program (captures are written to the current
+  *	    directory and removed).
+  * @retval 0 - all tests passed, 1 - failed.
+  */
+int main(void)
+{
+	unsigned uFail = 0;
+	
+	pfRec = malloc(sizeof(float)*IM_TEST_REC*IM_TEST_MOTORS*IM_TEST_STEPS);
+	pfRef = malloc(sizeof(float)*IM_TEST_OUT*IM_TEST_MOTORS*IM_TEST_STEPS);
+	if(!pfRec || !pfRef) return 1;
+	
+	tIMtest_setup();
+	if(tIMtest_plant() != 0) return 1;
+	tIMtest_ref();
+	
+	uFail += tIMtest_report("tIMspeedObs_calc (plant)", tIMtest_truth());
+	uFail += tIMtest_report("tIMspeedObsBank_calc", tIMtest_bank(0));
+	uFail += tIMtest_report("tIMspeedObsBank_calcTab", tIMtest_bank(1));
+	uFail += tIMtest_report("tIMspeedObsBank_calcRef", tIMtest_bank(2));
+	uFail += tIMtest_report("tIMspeedObs_calcBlock", tIMtest_block());
+	uFail += tIMtest_report("tIMspeedObs_calcBound", tIMtest_bound());
+	uFail += tIMtest_report("im::SpeedObserver", tIMtest_hpp(pfRec, pfRef));
+	uFail += tIMtest_report("tIMspeedObsQ31_calc", tIMtest_q31());
+	uFail += tIMtest_report("tIMbatch_run", tIMtest_batch());
+	
+	free(pfRec);
+	free(pfRef);
+	printf("%u failed\n", uFail);
+	return uFail ? 1 : 0;
+}
+
+/*********************************** END OF FILE ***********************************/
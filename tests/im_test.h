@@ -0,0 +1,92 @@
+/**
+  ***********************************************************************************
+  * @file    im_test.h
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file contains the scenario constants and function prototypes of
+  *	     the host regression test of the speed observer variants (the signals
+  *	     of the plant model, tIMspeedObs_calc is the reference).
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------------*/
+#ifndef __IM_TEST_H__
+#define __IM_TEST_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------------*/
+/* Exported constants -------------------------------------------------------------*/
+
+/**
+  * @brief Motor parameters and PI-adapter settings of the test (the same values are
+  *	   the run-time "tIMparams"/"tPI" settings and the compile-time constants of
+  *	   the C++ observer)
+  */
+#define IM_TEST_DT		0.0001f		// Sampling period, Sec
+#define IM_TEST_NPP		2.0f		// Number of pole pairs
+#define IM_TEST_RS		5.0f		// Stator resistance, Ohm
+#define IM_TEST_RR		4.516f		// Rotor resistance, Ohm
+#define IM_TEST_LS		0.143f		// Stator inductance, H
+#define IM_TEST_LR		0.143f		// Rotor inductance, H
+#define IM_TEST_LM		0.14f		// Magnetizing inductance, H
+#define IM_TEST_KP		0.1f		// PI-adapter proportional coef.
+#define IM_TEST_KI		10.0f		// PI-adapter integral coef.
+#define IM_TEST_LIM		600.0f		// PI-adapter output limits, Rad/Sec
+
+/**
+  * @brief Scenario: V/f start of every motor to its own speed, then the load step
+  *	   (IM_TEST_MOTORS is not a multiple of the SIMD lanes, so the bank tail
+  *	   is tested too)
+  */
+#define IM_TEST_MOTORS		13		// Count of motors (<= IM_PLANT_BANK_SIZE)
+#define IM_TEST_STEPS		30000		// Count of samples per motor
+#define IM_TEST_SKIP		20000		// Samples before the tolerance checks
+
+/**
+  * @brief Record of one sample: the channels of the capture files (IM_CAP_CH_*), the
+  *	   reference speed is the plant rotor mechanical speed
+  */
+#define IM_TEST_REC		5		// Floats per record
+#define IM_TEST_OUT		3		// Floats per output (fWrE, fFrAng, fFrMagn)
+
+/* Exported types -----------------------------------------------------------------*/
+/* Exported macro -----------------------------------------------------------------*/
+/* Exported functions -------------------------------------------------------------*/
+
+/* Compare the C++ observers with the reference outputs ****************************/
+int tIMtest_hpp(const float*, const float*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IM_TEST_H__ */
+
+/*********************************** END OF FILE ***********************************/
@@ -0,0 +1,102 @@
+/**
+  ***********************************************************************************
+  * @file    im_test_hpp.cpp
+  * @author  Serhii Yatsenko [royalroad1995@gmail.com]
+  * @version V1.1
+  * @date    Oct-2026
+  * @brief   This file provides the C++ part of the host regression test: the
+  *	     compile-time specialized observers (constant and run-time PI-adapter
+  *	     settings) against the reference outputs of tIMspeedObs_calc.
+  ***********************************************************************************
+  * @license
+  *
+  * MIT License
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ***********************************************************************************
+  */
+
+/* Includes -----------------------------------------------------------------------*/
+#include "im_test.h"
+#include "im_estimators.hpp"
+#include "im_capture.h"
+#include <cstring>
+
+/* Private typedef ----------------------------------------------------------------*/
+
+/* motor and PI-adapter constants of the test */
+struct Motor { static constexpr float fDt = IM_TEST_DT, fNpP = IM_TEST_NPP,
+	       fRs = IM_TEST_RS, fRr = IM_TEST_RR, fLs = IM_TEST_LS, fLr = IM_TEST_LR,
+	       fLm = IM_TEST_LM; };
+struct Gains { static constexpr float fKp = IM_TEST_KP, fKi = IM_TEST_KI,
+	       fUpOutLim = IM_TEST_LIM, fLowOutLim = -IM_TEST_LIM; };
+
+/* Private functions --------------------------------------------------------------*/
+
+/**
+  * @brief  Bit-equal comparison of the observer outputs with the reference.
+  * @param  sObs: tested observer,
+  *	    pfOut: pointer to the reference outputs of the sample.
+  * @retval 0 - equal, 1 - not equal.
+  */
+template<class Observer>
+static int tIMtest_cmpHpp(const Observer& sObs, const float* pfOut)
+{
+	const float afOut[IM_TEST_OUT] = {sObs.fWrE, sObs.fFrAng, sObs.fFrMagn};
+	
+	return std::memcmp(afOut, pfOut, sizeof(afOut)) ? 1 : 0;
+}
+
+/**
+  * @brief  C++ observers (im::PIconst and im::PIvar) against the reference.
+  * @param  pfRec: pointer to the records of all motors (IM_TEST_REC per sample),
+  *	    pfRef: pointer to the reference outputs (IM_TEST_OUT per sample).
+  * @retval Count of not equal samples.
+  */
+int tIMtest_hpp(const float* pfRec, const float* pfRef)
+{
+	int iBad = 0;
+	
+	for(unsigned m = 0; m < IM_TEST_MOTORS; m++)
+	{
+		im::SpeedObserver<Motor, im::PIconst<Gains>> sConst;
+		im::SpeedObserver<Motor, im::PIvar> sVar;
+		
+		sVar.sPI.fKp = IM_TEST_KP;
+		sVar.sPI.fKi = IM_TEST_KI;
+		sVar.sPI.fUpOutLim = IM_TEST_LIM;
+		sVar.sPI.fLowOutLim = -IM_TEST_LIM;
+		for(unsigned k = 0; k < IM_TEST_STEPS; k++)
+		{
+			size_t i = (size_t)m*IM_TEST_STEPS + k;
+			const float* pfIn = &pfRec[i*IM_TEST_REC];
+			
+			sConst.calc(pfIn[IM_CAP_CH_USAL], pfIn[IM_CAP_CH_USBE],
+				    pfIn[IM_CAP_CH_ISAL], pfIn[IM_CAP_CH_ISBE]);
+			sVar.calc(pfIn[IM_CAP_CH_USAL], pfIn[IM_CAP_CH_USBE],
+				  pfIn[IM_CAP_CH_ISAL], pfIn[IM_CAP_CH_ISBE]);
+			iBad += tIMtest_cmpHpp(sConst, &pfRef[i*IM_TEST_OUT]) |
+				tIMtest_cmpHpp(sVar, &pfRef[i*IM_TEST_OUT]);
+		}
+	}
+	return iBad;
+}
+
+/*********************************** END OF FILE ***********************************/